@@ -1,6 +1,9 @@
 from dataclasses import dataclass
+from contextlib import contextmanager
 import sys
 import os
+import json
+import time
 import hashlib
 import shutil
 import subprocess
@@ -93,7 +96,10 @@ class Cache:
             self.path = path
         self.cache_size = cache_size if cache_size is not None else MAX_CACHE_SIZE
         if not os.path.exists(self.path):
-            os.makedirs(self.path)
+            safe_makedirs(self.path)
+        # Fingerprints seen in this process, for the hit/miss statistics.
+        self._hits = set()
+        self._lookups = set()
 
     def transitive_fingerprint(
         self, filename, dependencies, compilation_options, flags=FingerprintFlags()
@@ -132,14 +138,24 @@ class Cache:
         # (E.g. a compression ratio of about 10 for Sage).
         if not os.path.exists(self.path):
             safe_makedirs(self.path)
+        self._lookups.add(fingerprint)
         gz_fingerprint_file = self.fingerprint_file(c_file, fingerprint, gzip_ext)
         if os.path.exists(gz_fingerprint_file):
+            self._hits.add(fingerprint)
             return gz_fingerprint_file
         zip_fingerprint_file = self.fingerprint_file(c_file, fingerprint, zip_ext)
         if os.path.exists(zip_fingerprint_file):
+            self._hits.add(fingerprint)
             return zip_fingerprint_file
         return None
 
+    def statistics(self):
+        """
+        Return the number of distinct cache hits and misses seen by this process.
+        """
+        hits = len(self._hits)
+        return {'hits': hits, 'misses': len(self._lookups) - hits}
+
     def load_from_cache(self, c_file, cached):
         ext = os.path.splitext(cached)[1]
         if ext == gzip_ext:
@@ -160,17 +176,26 @@ class Cache:
         artifacts = compilation_result.get_generated_source_files()
         if len(artifacts) == 1:
             fingerprint_file = self.fingerprint_file(c_file, fingerprint, gzip_ext)
+            tmp_file = self._temp_file_name(fingerprint_file)
             with open(c_file, "rb") as f:
-                with gzip_open(fingerprint_file + ".tmp", "wb") as g:
+                with gzip_open(tmp_file, "wb") as g:
                     shutil.copyfileobj(f, g)
         else:
             fingerprint_file = self.fingerprint_file(c_file, fingerprint, zip_ext)
+            tmp_file = self._temp_file_name(fingerprint_file)
             with zipfile.ZipFile(
-                fingerprint_file + ".tmp", "w", zipfile_compression_mode
+                tmp_file, "w", zipfile_compression_mode
             ) as zip:
                 for artifact in artifacts:
                     zip.write(artifact, os.path.basename(artifact))
-        os.rename(fingerprint_file + ".tmp", fingerprint_file)
+        self._publish(tmp_file, fingerprint_file)
+
+    def _temp_file_name(self, fingerprint_file):
+        # Concurrent writers of the same fingerprint must not share a temp file.
+        return "%s.%d.tmp" % (fingerprint_file, os.getpid())
+
+    def _publish(self, tmp_file, fingerprint_file):
+        os.replace(tmp_file, fingerprint_file)
 
     def cleanup_cache(self, ratio=0.85):
         try:
@@ -197,3 +222,188 @@ class Cache:
                 total_size -= size
                 if total_size < self.cache_size * ratio:
                     break
+
+
+def _current_umask():
+    mask = os.umask(0)
+    os.umask(mask)
+    return mask
+
+
+class ShardedCache(Cache):
+    r"""
+    A cache layout that can be shared between many concurrent processes and users,
+    e.g. build jobs on one CI machine or on a common NFS mount.
+
+    Entries are addressed by their fingerprint and spread over 256 subdirectories
+    to keep directory sizes small.  New entries are written to a process specific
+    temporary file and atomically renamed into place, so that readers never see
+    partial files and concurrent writers of the same entry cannot corrupt it.
+    Hits update the access time of an entry, and cleanup evicts the least recently
+    used entries first.  Only one process cleans up the cache at a time.
+
+    Hit/miss statistics are accumulated across all users of the cache
+    in the file ``stats.json``.
+    """
+    lock_timeout = 600  # seconds after which a cleanup lock is considered stale
+    temp_file_timeout = 3600  # seconds after which unpublished temp files are removed
+
+    def __init__(self, path, cache_size=None):
+        super().__init__(path, cache_size)
+        self._evicted = 0
+        self._stored_statistics = {}
+        self._file_mode = 0o666 & ~_current_umask()
+
+    def fingerprint_file(self, cfile, fingerprint, ext):
+        return join_path(
+            self.path, fingerprint[:2], "%s-%s%s" % (os.path.basename(cfile), fingerprint, ext))
+
+    def _temp_file_name(self, fingerprint_file):
+        safe_makedirs(os.path.dirname(fingerprint_file))
+        return "%s.%s-%d.tmp" % (fingerprint_file, _host_id(), os.getpid())
+
+    def _publish(self, tmp_file, fingerprint_file):
+        # Allow other users of the cache to read the entry, as far as the umask permits.
+        os.chmod(tmp_file, self._file_mode)
+        os.replace(tmp_file, fingerprint_file)
+
+    def lookup_cache(self, c_file, fingerprint):
+        cached = super().lookup_cache(c_file, fingerprint)
+        if cached:
+            # Mark the entry as recently used right away, so that a concurrent
+            # cleanup does not evict it between the lookup and the loading.
+            try:
+                os.utime(cached, None)
+            except FileNotFoundError:
+                self._hits.discard(fingerprint)
+                return None
+        return cached
+
+    def _lock_file(self, name):
+        return join_path(self.path, name + ".lock")
+
+    @contextmanager
+    def _locked(self, name, wait=0):
+        r"""
+        Acquire an exclusive lock file.  Yields True if the lock was acquired.
+        O_EXCL file creation works across processes, hosts and NFS mounts.
+        """
+        lock_file = self._lock_file(name)
+        deadline = time.time() + wait
+        acquired = False
+        while True:
+            try:
+                os.close(os.open(lock_file, os.O_CREAT | os.O_EXCL | os.O_WRONLY))
+                acquired = True
+                break
+            except FileExistsError:
+                try:
+                    if time.time() - os.stat(lock_file).st_mtime > self.lock_timeout:
+                        # Left behind by a crashed process.
+                        os.unlink(lock_file)
+                        continue
+                except FileNotFoundError:
+                    continue
+            if time.time() >= deadline:
+                break
+            time.sleep(0.05)
+        try:
+            yield acquired
+        finally:
+            if acquired:
+                try:
+                    os.unlink(lock_file)
+                except FileNotFoundError:
+                    pass
+
+    def _iter_entries(self):
+        now = time.time()
+        for shard in os.scandir(self.path):
+            if not shard.is_dir(follow_symlinks=False) or len(shard.name) != 2:
+                continue
+            for entry in os.scandir(shard.path):
+                try:
+                    s = entry.stat(follow_symlinks=False)
+                except FileNotFoundError:
+                    continue
+                if entry.name.endswith(".tmp"):
+                    if now - s.st_mtime > self.temp_file_timeout:
+                        _unlink_if_exists(entry.path)
+                    continue
+                yield s.st_atime, s.st_size, entry.path
+
+    def cleanup_cache(self, ratio=0.85):
+        with self._locked("cleanup") as acquired:
+            if acquired:
+                # Another process is already cleaning up otherwise.
+                entries = list(self._iter_entries())
+                total_size = sum(size for _, size, _ in entries)
+                if total_size > self.cache_size:
+                    entries.sort()  # least recently used first
+                    for _, size, path in entries:
+                        if _unlink_if_exists(path):
+                            self._evicted += 1
+                        total_size -= size
+                        if total_size < self.cache_size * ratio:
+                            break
+        self.store_statistics()
+
+    def statistics(self):
+        stats = super().statistics()
+        stats['evicted'] = self._evicted
+        return stats
+
+    def load_statistics(self):
+        """
+        Return the statistics accumulated by all users of this cache.
+        """
+        try:
+            with open(join_path(self.path, "stats.json")) as f:
+                return json.load(f)
+        except (OSError, ValueError):
+            return {}
+
+    def store_statistics(self):
+        """
+        Add the statistics of this process to the totals in ``stats.json``.
+        """
+        stats = self.statistics()
+        # Only add what was not stored before.
+        delta = {key: value - self._stored_statistics.get(key, 0) for key, value in stats.items()}
+        if not any(delta.values()):
+            return
+        with self._locked("stats", wait=2) as acquired:
+            if not acquired:
+                return
+            total = self.load_statistics()
+            for key, value in delta.items():
+                total[key] = total.get(key, 0) + value
+            stats_file = join_path(self.path, "stats.json")
+            tmp_file = "%s.%s-%d.tmp" % (stats_file, _host_id(), os.getpid())
+            with open(tmp_file, "w") as f:
+                json.dump(total, f)
+            self._publish(tmp_file, stats_file)
+        self._stored_statistics = stats
+
+
+@cached_function
+def _host_id():
+    import socket
+    return socket.gethostname().replace(os.sep, '_').replace('.', '_') or 'localhost'
+
+
+def _unlink_if_exists(path):
+    try:
+        os.unlink(path)
+    except FileNotFoundError:
+        return False
+    return True
+
+
+def create_cache(options):
+    """
+    Create the cache configured by the compilation options.
+    """
+    cache_path = None if options.cache is True else options.cache
+    cache_class = ShardedCache if getattr(options, 'cache_sharded', False) else Cache
+    return cache_class(cache_path, getattr(options, 'cache_size', None))
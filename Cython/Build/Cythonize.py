@@ -232,6 +232,11 @@ Environment variables:
     parser.add_argument('--annotate-fullc', action='store_const', const='fullc', dest='annotate',
                       help='Produce a colorized HTML version of the source '
                            'which includes entire generated C/C++-code.')
+    parser.add_argument('--split-output', dest='split_output', metavar='N', type=int, default=None,
+                      help='distribute the generated functions of each module over N C files')
+    parser.add_argument('--shared', dest='shared_utility_qualified_name', metavar='MODULE', type=str, default=None,
+                      help='move the utility code into the shared module MODULE (fully qualified name), '
+                           'which is generated and built along with the other modules')
     parser.add_argument('-x', '--exclude', metavar='PATTERN', dest='excludes',
                       action='append', default=[],
                       help='exclude certain file patterns from the compilation')
@@ -296,6 +301,11 @@ def parse_args(args):
         assert options.language_level in (2, 3, '3str')
         options.options['language_level'] = options.language_level
 
+    if options.split_output:
+        options.options['split_output'] = options.split_output
+    if options.shared_utility_qualified_name:
+        options.options['shared_utility_qualified_name'] = options.shared_utility_qualified_name
+
     if options.lenient:
         # increase Python compatibility by ignoring compile time errors
         Options.error_on_unknown_names = False
@@ -1,12 +1,14 @@
 import cython
 
 import collections
+import hashlib
+import json
 import os
 import re, sys, time
 from glob import iglob
 from io import StringIO
 from os.path import relpath as _relpath
-from .Cache import Cache, FingerprintFlags
+from .Cache import create_cache, file_hash, get_cython_cache_dir, FingerprintFlags
 
 from collections.abc import Iterable
 
@@ -516,16 +518,121 @@ def parse_dependencies(source_filename):
     return cimports, includes, externs, distutils_info
 
 
+class DependencyIndex:
+    """
+    Persistent index of the per-file dependency facts that parse_dependencies()
+    extracts, so that unchanged sources need not be scanned again on each run.
+
+    Entries are validated by file size and modification time, and by content hash
+    if those differ (e.g. after a fresh checkout).  Changed files are re-parsed and
+    the index is written back by save() if anything was updated.
+    """
+    def __init__(self, path):
+        self.path = path
+        self._entries = {}
+        self._compile_times = {}
+        self._parsed = {}
+        self._dirty = False
+        self.hits = self.misses = 0
+        self._load()
+
+    def _load(self):
+        try:
+            with open(self.path, encoding='utf-8') as f:
+                data = json.load(f)
+        except (OSError, ValueError):
+            return
+        if isinstance(data, dict) and data.get('version') == Utils.cython_version:
+            self._entries = data.get('files', {})
+            self._compile_times = data.get('compile_times', {})
+
+    def save(self):
+        if not self._dirty:
+            return
+        dir_name = os.path.dirname(self.path)
+        if dir_name:
+            safe_makedirs(dir_name)
+        tmp_path = "%s.%d.tmp" % (self.path, os.getpid())
+        with open(tmp_path, 'w', encoding='utf-8') as f:
+            json.dump({
+                'version': Utils.cython_version,
+                'files': self._entries,
+                'compile_times': self._compile_times,
+            }, f)
+        os.replace(tmp_path, self.path)
+        self._dirty = False
+
+    def parse_dependencies(self, source_filename):
+        try:
+            return self._parsed[source_filename]
+        except KeyError:
+            pass
+
+        st = os.stat(source_filename)
+        stat_key = [st.st_size, st.st_mtime_ns]
+        entry = self._entries.get(source_filename)
+        if entry is not None and entry['stat'] != stat_key:
+            if entry['hash'] == file_hash(source_filename):
+                entry['stat'] = stat_key
+                self._dirty = True
+            else:
+                entry = None
+
+        if entry is None:
+            self.misses += 1
+            cimports, includes, externs, distutils_info = parse_dependencies(source_filename)
+            # Round-trip through JSON to get a private copy of the (mutable) values
+            # that looks exactly like what a later run loads from disk.
+            entry = self._entries[source_filename] = json.loads(json.dumps({
+                'stat': stat_key,
+                'hash': file_hash(source_filename),
+                'cimports': cimports,
+                'includes': includes,
+                'externs': externs,
+                'distutils': distutils_info.values,
+            }))
+            self._dirty = True
+        else:
+            self.hits += 1
+
+        distutils_info = DistutilsInfo()
+        for key, value in entry['distutils'].items():
+            if key == 'define_macros':
+                value = [tuple(macro) for macro in value]
+            distutils_info.values[key] = value
+        result = self._parsed[source_filename] = (
+            entry['cimports'], entry['includes'], entry['externs'], distutils_info)
+        return result
+
+    def compile_time(self, source_filename):
+        """
+        Return the time in seconds that the last compilation of the source file took, or None.
+        """
+        return self._compile_times.get(source_filename)
+
+    def record_compile_time(self, source_filename, seconds):
+        self._compile_times[source_filename] = round(seconds, 3)
+        self._dirty = True
+
+
+def default_dependency_index_path():
+    cwd_hash = hashlib.sha256(os.getcwd().encode('utf-8')).hexdigest()[:16]
+    return join_path(get_cython_cache_dir(), "dependencies", cwd_hash + ".json")
+
+
 class DependencyTree:
 
-    def __init__(self, context, quiet=False):
+    def __init__(self, context, quiet=False, index=None):
         self.context = context
         self.quiet = quiet
+        self.index = index
         self._transitive_cache = {}
 
     def parse_dependencies(self, source_filename):
         if path_exists(source_filename):
             source_filename = os.path.normpath(source_filename)
+            if self.index is not None:
+                return self.index.parse_dependencies(source_filename)
         return parse_dependencies(source_filename)
 
     @cached_method
@@ -697,13 +804,15 @@ class DependencyTree:
 
 _dep_tree = None
 
-def create_dependency_tree(ctx=None, quiet=False):
+def create_dependency_tree(ctx=None, quiet=False, index=None):
     global _dep_tree
     if _dep_tree is None:
         if ctx is None:
             ctx = Context(["."], get_directive_defaults(),
                           options=CompilationOptions(default_options))
-        _dep_tree = DependencyTree(ctx, quiet=quiet)
+        _dep_tree = DependencyTree(ctx, quiet=quiet, index=index)
+    elif index is not None and _dep_tree.index is None:
+        _dep_tree.index = index
     return _dep_tree
 
 
@@ -725,7 +834,7 @@ def default_create_extension(template, kwds):
 
 # This may be useful for advanced users?
 def create_extension_list(patterns, exclude=None, ctx=None, aliases=None, quiet=False, language=None,
-                          exclude_failures=False):
+                          exclude_failures=False, build_shared_utility=True):
     if language is not None:
         print('Warning: passing language={0!r} to cythonize() is deprecated. '
               'Instead, put "# distutils: language={0}" in your .pyx or .pxd file(s)'.format(language))
@@ -787,18 +896,8 @@ def create_extension_list(patterns, exclude=None, ctx=None, aliases=None, quiet=
                           "for sharing declarations among Cython files." % (pattern.name, cython_sources))
             elif shared_utility_qualified_name and pattern.name == shared_utility_qualified_name:
                 # This is the shared utility code file.
-                sources = pattern.sources or [
-                        shared_utility_qualified_name.replace('.', os.sep) + ('.cpp' if pattern.language == 'c++' else '.c')]
-                m, _ = create_extension(pattern, dict(
-                    name=shared_utility_qualified_name,
-                    sources=sources,
-                    language=pattern.language,
-                    # shared utility code uses only parameters specified as argument of Extension() class
-                    **base.values
-                ))
-                m.np_pythran = False
-                m.shared_utility_qualified_name = None
-                module_list.append(m)
+                module_list.append(_create_shared_utility_extension(
+                    create_extension, pattern, shared_utility_qualified_name, pattern.language, base.values))
                 continue
             else:
                 # ignore non-cython modules
@@ -872,9 +971,36 @@ def create_extension_list(patterns, exclude=None, ctx=None, aliases=None, quiet=
                         print("Warning: Cython source file not found in sources list, adding %s" % file)
                     m.sources.insert(0, file)
                 seen.add(name)
+
+    if (build_shared_utility and shared_utility_qualified_name
+            and shared_utility_qualified_name not in explicit_modules):
+        # Build the shared utility module along with the modules that use it.
+        shared_users = [m for m in module_list
+                        if getattr(m, 'shared_utility_qualified_name', None) == shared_utility_qualified_name]
+        if shared_users:
+            shared_language = 'c++' if all(m.language == 'c++' for m in shared_users) else None
+            module_list.append(_create_shared_utility_extension(
+                create_extension, Extension(shared_utility_qualified_name, []),
+                shared_utility_qualified_name, shared_language, {}))
+
     return module_list, module_metadata
 
 
+def _create_shared_utility_extension(create_extension, template, qualified_name, language, values):
+    sources = template.sources or [
+        qualified_name.replace('.', os.sep) + ('.cpp' if language == 'c++' else '.c')]
+    m, _ = create_extension(template, dict(
+        name=qualified_name,
+        sources=sources,
+        language=language,
+        # shared utility code uses only parameters specified as argument of Extension() class
+        **values
+    ))
+    m.np_pythran = False
+    m.shared_utility_qualified_name = None
+    return m
+
+
 # This is the user-exposed entry point.
 def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False, force=None, language=None,
               exclude_failures=False, show_all_warnings=False, **options):
@@ -952,9 +1078,17 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
                                 See :ref:`compiler-directives`.
 
     :param depfile: produce depfiles for the sources if True.
+    :param dependency_index: If ``True``, the dependencies found in the source files are remembered
+                  in an index file in the Cython cache directory and only changed files are scanned
+                  again in later runs.  If the value is a file path, the index is stored in that file.
     :param cache: If ``True`` the cache enabled with default path. If the value is a path to a directory,
                   then the directory is used to cache generated ``.c``/``.cpp`` files. By default cache is disabled.
                   See :ref:`cython-cache`.
+    :param common_utility_include_dir: Path to a directory in which runtime support code is shared
+                  between modules as header files, instead of copying it into each C file.
+                  See :ref:`common-utility-include-dir`.
+    :param build_shared_utility: If ``False``, the shared utility module of ``shared_utility_qualified_name``
+                  is not added to the extension list unless it is passed as an explicit ``Extension``.
     """
     if exclude is None:
         exclude = []
@@ -964,6 +1098,13 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
         safe_makedirs(options['common_utility_include_dir'])
 
     depfile = options.pop('depfile', None)
+    build_shared_utility = options.pop('build_shared_utility', True)
+    dependency_index = options.pop('dependency_index', None)
+    if dependency_index:
+        dependency_index = DependencyIndex(
+            default_dependency_index_path() if dependency_index is True else dependency_index)
+    else:
+        dependency_index = None
 
     if pythran is None:
         pythran_options = None
@@ -980,6 +1121,7 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
     ctx = Context.from_options(c_options)
     options = c_options
     shared_utility_qualified_name = ctx.shared_utility_qualified_name
+    deps = create_dependency_tree(ctx, quiet=quiet, index=dependency_index)
     module_list, module_metadata = create_extension_list(
         module_list,
         exclude=exclude,
@@ -987,17 +1129,17 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
         quiet=quiet,
         exclude_failures=exclude_failures,
         language=language,
-        aliases=aliases)
+        aliases=aliases,
+        build_shared_utility=build_shared_utility)
 
-    deps = create_dependency_tree(ctx, quiet=quiet)
     build_dir = getattr(options, 'build_dir', None)
-    if options.cache and not (options.annotate or Options.annotate):
+    if options.cache and not (options.annotate or Options.annotate or options.split_output):
         # cache is enabled when:
         # * options.cache is True (the default path to the cache base dir is used)
         # * options.cache is the explicit path to the cache base dir
         # * annotations are not generated
-        cache_path = None if options.cache is True else options.cache
-        cache = Cache(cache_path, getattr(options, 'cache_size', None))
+        # * the output is not split into several C files
+        cache = create_cache(options)
     else:
         cache = None
 
@@ -1052,11 +1194,14 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
         new_sources = []
         for source in m.sources:
             base, ext = os.path.splitext(source)
+            split_c_files = []
             if ext in ('.pyx', '.py'):
                 c_file = base + ('.cpp' if m.language == 'c++' or np_pythran else '.c')
 
                 # setup for out of place build directory if enabled
                 c_file = file_in_build_dir(c_file)
+                if options.split_output and options.split_output > 1:
+                    split_c_files = Utils.split_output_files(c_file, options.split_output)[1]
 
                 # write out the depfile, if requested
                 if depfile:
@@ -1064,7 +1209,7 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
                     write_depfile(c_file, source, dependencies)
 
                 # Missing files and those generated by other Cython versions should always be recreated.
-                if Utils.file_generated_by_this_cython(c_file):
+                if Utils.file_generated_by_this_cython(c_file) and all(map(os.path.exists, split_c_files)):
                     c_timestamp = os.path.getmtime(c_file)
                 else:
                     c_timestamp = -1
@@ -1093,6 +1238,15 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
                         )
                     else:
                         fingerprint = None
+                    cached = fingerprint and cache.lookup_cache(c_file, fingerprint)
+                    if cached:
+                        # Resolve cache hits right here instead of passing them to the workers.
+                        if not quiet:
+                            print(f"Found compiled {Utils.decode_filename(source)} in cache")
+                        cache.load_from_cache(c_file, cached)
+                        modules_by_cfile[c_file].append(m)
+                        new_sources.append(c_file)
+                        continue
                     to_compile.append((
                         priority, source, c_file, fingerprint, quiet,
                         options, not exclude_failures, module_metadata.get(m.name),
@@ -1116,11 +1270,28 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
                     copy_to_build_dir(source)
 
             new_sources.append(c_file)
+            new_sources.extend(split_c_files)
 
         m.sources = new_sources
 
-    to_compile.sort()
+    if dependency_index is not None:
+        dependency_index.save()
+
     N = len(to_compile)
+    if N <= 1:
+        nthreads = 0
+    try:
+        from concurrent.futures import ProcessPoolExecutor
+    except ImportError:
+        nthreads = 0
+
+    if nthreads:
+        # Start the most expensive compilations first, so that a large module
+        # does not end up as the last job that all other workers wait for.
+        compile_cost = _estimate_compile_times(deps, dependency_index, [task[1] for task in to_compile])
+        to_compile.sort(key=lambda task: (-compile_cost[task[1]], task[1]))
+    else:
+        to_compile.sort()
 
     # Drop "priority" sorting component of "to_compile" entries
     # and add a simple progress indicator and the remaining arguments.
@@ -1130,27 +1301,34 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
         for i, task in enumerate(to_compile, 1)
     ]
 
-    if N <= 1:
-        nthreads = 0
-    try:
-        from concurrent.futures import ProcessPoolExecutor
-    except ImportError:
-        nthreads = 0
-
     if nthreads:
         with ProcessPoolExecutor(
             max_workers=nthreads,
             initializer=_init_multiprocessing_helper,
         ) as proc_pool:
             try:
-                list(proc_pool.map(cythonize_one_helper, to_compile, chunksize=1))
+                compile_times = list(proc_pool.map(cythonize_one_helper, to_compile, chunksize=1))
             except KeyboardInterrupt:
                 proc_pool.terminate_workers()
                 proc_pool.shutdown(cancel_futures=True)
                 raise
     else:
+        compile_times = []
         for args in to_compile:
+            t = time.perf_counter()
             cythonize_one(*args)
+            compile_times.append(time.perf_counter() - t)
+
+    compile_times = [(task[0], seconds) for task, seconds in zip(to_compile, compile_times)]
+    if dependency_index is not None:
+        for source, seconds in compile_times:
+            dependency_index.record_compile_time(source, seconds)
+        dependency_index.save()
+    if not quiet and len(compile_times) > 1 and (nthreads or c_options.verbose):
+        compile_times.sort(key=lambda item: item[1], reverse=True)
+        print("Slowest Cython compilations:")
+        for source, seconds in compile_times[:5]:
+            print(f"  {seconds:8.2f}s  {Utils.decode_filename(source)}")
 
     if exclude_failures:
         failed_modules = set()
@@ -1173,6 +1351,11 @@ def cythonize(module_list, exclude=None, nthreads=0, aliases=None, quiet=False,
 
     if cache:
         cache.cleanup_cache()
+        if not quiet:
+            stats = cache.statistics()
+            if stats['hits'] or stats['misses']:
+                print("Cython cache: %s" % ', '.join(
+                    f"{count} {name}" for name, count in stats.items()))
 
     # cythonize() is often followed by the (non-Python-buffered)
     # compiler output, flush now to avoid interleaving output.
@@ -1268,14 +1451,52 @@ def cythonize_one(pyx_file, c_file,
 
 def cythonize_one_helper(m):
     import traceback
+    t = time.perf_counter()
     try:
-        return cythonize_one(*m)
+        cythonize_one(*m)
     except Exception:
         traceback.print_exc()
         raise
+    return time.perf_counter() - t
+
+
+def _estimate_compile_times(deps, dependency_index, sources):
+    """
+    Estimate the compile time of each source file from its last recorded compile time,
+    or otherwise from the size of the source and its dependencies,
+    calibrated against the recorded timings.
+    """
+    sizes = {
+        source: sum(_file_size(dep) for dep in deps.all_dependencies(source))
+        for source in sources
+    }
+    recorded = {}
+    if dependency_index is not None:
+        for source in sources:
+            seconds = dependency_index.compile_time(source)
+            if seconds is not None:
+                recorded[source] = seconds
+
+    recorded_size = sum(sizes[source] for source in recorded)
+    seconds_per_byte = sum(recorded.values()) / recorded_size if recorded_size else 1e-5
+    return {
+        source: recorded[source] if source in recorded else sizes[source] * seconds_per_byte
+        for source in sources
+    }
+
+
+def _file_size(filename):
+    try:
+        return os.path.getsize(filename)
+    except OSError:
+        return 0
 
 
 def _init_multiprocessing_helper():
     # KeyboardInterrupt kills workers, so don't let them get it
     import signal
     signal.signal(signal.SIGINT, signal.SIG_IGN)
+    # Warm up the worker process by importing the compiler and building the scanner
+    # tables, which would otherwise count into the compile time of its first module.
+    from ..Compiler import Pipeline, ParseTreeTransforms, Scanning
+    Scanning.get_lexicon()
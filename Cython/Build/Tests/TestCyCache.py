@@ -6,6 +6,7 @@ import sys
 import tempfile
 import unittest
 
+import Cython.Build.Cache
 import Cython.Build.Dependencies
 import Cython.Compiler.Main
 import Cython.Utils
@@ -193,3 +194,71 @@ class TestCyCache(CythonTest):
 
     def test_options_invalidation_compile(self):
         self._test_options_invalidation(self.fresh_compile)
+
+    def test_sharded_cache_layout(self):
+        a_pyx = os.path.join(self.src_dir, 'a.pyx')
+        a_c = a_pyx[:-4] + '.c'
+        with open(a_pyx, 'w') as f:
+            f.write('value = 1\n')
+
+        self.fresh_cythonize(a_pyx, cache=self.cache_dir, cache_sharded=True)
+        entries = self.cache_files('??/a.c-*')
+        self.assertEqual(1, len(entries), entries)
+        shard, entry = os.path.split(entries[0])
+        self.assertTrue(entry.startswith('a.c-' + os.path.basename(shard)), entry)
+        self.assertEqual([], self.cache_files('??/*.tmp'))
+
+        with open(a_c) as f:
+            a_contents = f.read()
+        os.unlink(a_c)
+        self.fresh_cythonize(a_pyx, cache=self.cache_dir, cache_sharded=True)
+        with open(a_c) as f:
+            self.assertEqual(a_contents, f.read())
+
+        stats = Cython.Build.Cache.ShardedCache(self.cache_dir).load_statistics()
+        self.assertEqual({'hits': 1, 'misses': 1, 'evicted': 0}, stats)
+
+    def test_sharded_cache_compile(self):
+        a_pyx = os.path.join(self.src_dir, 'a.pyx')
+        with open(a_pyx, 'w') as f:
+            f.write('value = 1\n')
+
+        self.fresh_compile(a_pyx, cache=self.cache_dir, cache_sharded=True)
+        self.assertEqual(1, len(self.cache_files('??/a.c-*')))
+        self.assertEqual([], self.cache_files('a.c-*'))
+
+    def test_sharded_cache_evicts_least_recently_used(self):
+        cache = Cython.Build.Cache.ShardedCache(self.cache_dir, cache_size=2500)
+        paths = []
+        for i in range(4):
+            fingerprint = '%02x' % i + '0' * 62
+            path = cache.fingerprint_file('m%d.c' % i, fingerprint, '.gz')
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path, 'wb') as f:
+                f.write(b'x' * 1000)
+            os.utime(path, (1000 + i, 1000 + i))
+            paths.append(path)
+        # Using the oldest entry makes it the most recently used one.
+        self.assertEqual(paths[0], cache.lookup_cache('m0.c', '00' + '0' * 62))
+
+        cache.cleanup_cache()
+        self.assertEqual(
+            [True, False, False, True],
+            [os.path.exists(path) for path in paths])
+        self.assertEqual(2, cache.statistics()['evicted'])
+
+    def test_sharded_cache_cleanup_lock(self):
+        cache = Cython.Build.Cache.ShardedCache(self.cache_dir, cache_size=0)
+        path = cache.fingerprint_file('m.c', 'ab' + '0' * 62, '.gz')
+        os.makedirs(os.path.dirname(path))
+        with open(path, 'wb') as f:
+            f.write(b'x' * 1000)
+
+        with cache._locked("cleanup") as acquired:
+            self.assertTrue(acquired)
+            # A concurrent cleanup must leave the cache alone.
+            other = Cython.Build.Cache.ShardedCache(self.cache_dir, cache_size=0)
+            other.cleanup_cache()
+            self.assertTrue(os.path.exists(path))
+        cache.cleanup_cache()
+        self.assertFalse(os.path.exists(path))
@@ -478,3 +478,9 @@ class TestParseArgs(TimedTest):
         self.assertEqual(sources, ['foo.pyx'])
         self.assertEqual(Options.docstrings, False)
         self.check_default_global_options(['docstrings'])
+
+    def test_shared(self):
+        options, sources = parse_args(['foo.pyx', '--shared=pkg._cyutility'])
+        self.assertEqual(sources, ['foo.pyx'])
+        self.assertEqual(options.options['shared_utility_qualified_name'], 'pkg._cyutility')
+        self.check_default_global_options()
@@ -3,8 +3,9 @@ import os
 import tempfile
 from os.path import join as pjoin
 
-from ..Dependencies import extended_iglob
+from ..Dependencies import extended_iglob, DependencyIndex, _estimate_compile_times
 from ...TestUtils import TimedTest
+from ...Utils import clear_function_caches
 
 
 @contextlib.contextmanager
@@ -131,3 +132,95 @@ class TestGlobbing(TimedTest):
         self.files_equal("**/*.{py}", all_files[1::2])
         self.files_equal("*/*/*.py", files[1::2])
         self.files_equal("**/*.py", all_files[1::2])
+
+
+class TestDependencyIndex(TimedTest):
+    def setUp(self):
+        super().setUp()
+        self._tmpdir = tempfile.TemporaryDirectory()
+        self.temp_path = self._tmpdir.name
+        self.index_path = pjoin(self.temp_path, "index", "deps.json")
+        self.source = pjoin(self.temp_path, "a.pyx")
+        self.write_source(
+            "# distutils: define_macros = A=1\n"
+            "from libc.math cimport sqrt\n"
+            "include 'a.pxi'\n")
+
+    def tearDown(self):
+        self._tmpdir.cleanup()
+        super().tearDown()
+
+    def write_source(self, code):
+        with writable_file(self.temp_path, "a.pyx") as f:
+            f.write(code)
+
+    def check_parse(self, index, expected_cimports):
+        cimports, includes, externs, distutils_info = index.parse_dependencies(self.source)
+        self.assertEqual(expected_cimports, cimports)
+        self.assertEqual(['a.pxi'], includes)
+        self.assertEqual([], externs)
+        self.assertEqual({'define_macros': [('A', '1')]}, distutils_info.values)
+
+    def test_reuse_unchanged(self):
+        index = DependencyIndex(self.index_path)
+        self.check_parse(index, ['libc.math'])
+        self.assertEqual((0, 1), (index.hits, index.misses))
+        index.save()
+
+        clear_function_caches()  # simulate a new process
+        index = DependencyIndex(self.index_path)
+        self.check_parse(index, ['libc.math'])
+        self.assertEqual((1, 0), (index.hits, index.misses))
+
+    def test_touched_file_is_validated_by_hash(self):
+        index = DependencyIndex(self.index_path)
+        self.check_parse(index, ['libc.math'])
+        index.save()
+
+        st = os.stat(self.source)
+        os.utime(self.source, ns=(st.st_atime_ns, st.st_mtime_ns + 10**9))
+        clear_function_caches()  # simulate a new process
+        index = DependencyIndex(self.index_path)
+        self.check_parse(index, ['libc.math'])
+        self.assertEqual((1, 0), (index.hits, index.misses))
+
+    def test_changed_file_is_parsed(self):
+        index = DependencyIndex(self.index_path)
+        self.check_parse(index, ['libc.math'])
+        index.save()
+
+        self.write_source(
+            "# distutils: define_macros = A=1\n"
+            "cimport libc.math, libc.stdlib\n"
+            "include 'a.pxi'\n")
+        st = os.stat(self.source)
+        os.utime(self.source, ns=(st.st_atime_ns, st.st_mtime_ns + 10**9))
+        clear_function_caches()  # simulate a new process
+        index = DependencyIndex(self.index_path)
+        self.check_parse(index, ['libc.math', 'libc.stdlib'])
+        self.assertEqual((0, 1), (index.hits, index.misses))
+
+    def test_compile_time_estimates(self):
+        class FakeDependencyTree:
+            def all_dependencies(self, source):
+                return {source}
+
+        sources = []
+        for name, size in [("small.pyx", 100), ("medium.pyx", 1000), ("large.pyx", 10000)]:
+            with writable_file(self.temp_path, name) as f:
+                f.write("x" * size)
+            sources.append(pjoin(self.temp_path, name))
+        small, medium, large = sources
+
+        index = DependencyIndex(self.index_path)
+        index.record_compile_time(medium, 2.0)
+        index.save()
+
+        index = DependencyIndex(self.index_path)
+        self.assertEqual(2.0, index.compile_time(medium))
+        self.assertIsNone(index.compile_time(large))
+        estimates = _estimate_compile_times(FakeDependencyTree(), index, sources)
+        # Unrecorded files are estimated by size, calibrated against the recorded timings.
+        self.assertAlmostEqual(0.2, estimates[small])
+        self.assertAlmostEqual(2.0, estimates[medium])
+        self.assertAlmostEqual(20.0, estimates[large])
@@ -1,3 +1,5 @@
+import contextlib
+import io
 import shutil
 import os
 import tempfile
@@ -11,7 +13,7 @@ from Cython.TestUtils import CythonTest
 def fresh_cythonize(*args, **kwargs):
     Cython.Utils.clear_function_caches()
     Cython.Build.Dependencies._dep_tree = None  # discard method caches
-    Cython.Build.Dependencies.cythonize(*args, **kwargs)
+    return Cython.Build.Dependencies.cythonize(*args, **kwargs)
 
 class TestRecythonize(CythonTest):
 
@@ -210,3 +212,78 @@ class TestRecythonize(CythonTest):
         self.assertFalse("__pyx_v_1a_value = 2;" in b_c_contents2)
         self.assertTrue("__pyx_v_1a_value = 2.0;" in b_c_contents2)
         self.assertFalse("__pyx_v_1a_value = 2.0;" in b_c_contents1)
+
+    def test_compile_time_report(self):
+
+        src_dir = tempfile.mkdtemp(prefix='src', dir=self.temp_dir)
+        sources = [os.path.join(src_dir, name) for name in ('a.pyx', 'b.pyx')]
+        for source in sources:
+            with open(source, 'w') as f:
+                f.write('def f(x):\n    return x\n')
+
+        # Sequential builds only report the compile times when asked to be verbose.
+        with contextlib.redirect_stdout(io.StringIO()) as output:
+            fresh_cythonize(sources)
+        self.assertNotIn("Slowest Cython compilations:", output.getvalue())
+
+        with contextlib.redirect_stdout(io.StringIO()) as output:
+            fresh_cythonize(sources, force=True, verbose=True)
+        self.assertIn("Slowest Cython compilations:", output.getvalue())
+
+    def test_split_output_sources(self):
+
+        src_dir = tempfile.mkdtemp(prefix='src', dir=self.temp_dir)
+
+        a_pyx = os.path.join(src_dir, 'a.pyx')
+        a_parts = [os.path.join(src_dir, 'a.part%d.c' % i) for i in (1, 2)]
+
+        with open(a_pyx, 'w') as f:
+            for i in range(6):
+                f.write('def f%d(x):\n    return x + %d\n\n' % (i, i))
+
+        modules = fresh_cythonize(a_pyx, split_output=3)
+        self.assertEqual([os.path.join(src_dir, 'a.c')] + a_parts, modules[0].sources)
+        self.assertTrue(os.path.exists(os.path.join(src_dir, 'a.parts.h')))
+
+        # Sleep to address coarse time-stamp precision.
+        time.sleep(1)
+        mtimes = [os.path.getmtime(part) for part in a_parts]
+
+        # Parts that did not change are not rewritten.
+        fresh_cythonize(a_pyx, split_output=3, force=True)
+        self.assertEqual(mtimes, [os.path.getmtime(part) for part in a_parts])
+
+    def test_split_output_parallel_compile(self):
+        from distutils.ccompiler import new_compiler
+        from Cython.Distutils.build_ext import compile_sources_in_parallel, is_split_module
+
+        self.assertTrue(is_split_module(['a.c', 'a.part1.c', 'a.part2.c', 'b.c']))
+        self.assertFalse(is_split_module(['a.c', 'b.c']))
+
+        # The parallel compile method is only installed while building the extension.
+        compiler = new_compiler(compiler='unix')
+        with compile_sources_in_parallel(compiler, 2):
+            self.assertIn('compile', vars(compiler))
+        self.assertNotIn('compile', vars(compiler))
+
+    def test_implicit_shared_utility_module(self):
+
+        src_dir = tempfile.mkdtemp(prefix='src', dir=self.temp_dir)
+        pkg_dir = os.path.join(src_dir, 'pkg')
+        os.mkdir(pkg_dir)
+        open(os.path.join(pkg_dir, '__init__.py'), 'w').close()
+
+        a_pyx = os.path.join(pkg_dir, 'a.pyx')
+        with open(a_pyx, 'w') as f:
+            f.write('def f(x):\n    return [x]\n')
+
+        cwd = os.getcwd()
+        os.chdir(src_dir)
+        try:
+            modules = fresh_cythonize('pkg/a.pyx', shared_utility_qualified_name='pkg._cyutility')
+        finally:
+            os.chdir(cwd)
+
+        self.assertEqual(['pkg.a', 'pkg._cyutility'], [m.name for m in modules])
+        self.assertEqual([os.path.join('pkg', '_cyutility.c')], modules[1].sources)
+        self.assertTrue(os.path.exists(os.path.join(pkg_dir, '_cyutility.c')))
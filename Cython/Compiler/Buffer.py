@@ -421,7 +421,8 @@ def put_assign_to_buffer(lhs_cname, rhs_cname, buf_entry,
 
 
 def put_buffer_lookup_code(entry, index_signeds, index_cnames, directives,
-                           pos, code, negative_indices, in_nogil_context):
+                           pos, code, negative_indices, in_nogil_context, index_guards=None,
+                           hoisted_access=None):
     """
     Generates code to process indices and calculate an offset into
     a buffer. Returns a C string which gives a pointer which can be
@@ -434,17 +435,31 @@ def put_buffer_lookup_code(entry, index_signeds, index_cnames, directives,
     once per ndim (lookup with suboffsets tend to get quite complicated).
 
     entry is a BufferEntry
+
+    index_guards optionally gives for each index None if it needs checking,
+    True if it is known to be within bounds, or the C name of a flag that is
+    true if it is within bounds.
+
+    hoisted_access is an optional MemoryView.HoistedSliceAccess that provides
+    the row address and strides of a memoryview slice.
     """
     negative_indices = directives['wraparound'] and negative_indices
+    if index_guards is None:
+        index_guards = [None] * len(index_cnames)
 
-    if directives['boundscheck']:
+    if directives['boundscheck'] and not all(guard is True for guard in index_guards):
         # Check bounds and fix negative indices.
         # We allocate a temporary which is initialized to -1, meaning OK (!).
         # If an error occurs, the temp is set to the index dimension the
         # error is occurring at.
         failed_dim_temp = code.funcstate.allocate_temp(PyrexTypes.c_int_type, manage_ref=False)
         code.putln("%s = -1;" % failed_dim_temp)
-        for dim, (signed, cname, shape) in enumerate(zip(index_signeds, index_cnames, entry.get_buf_shapevars())):
+        for dim, (signed, cname, shape, guard) in enumerate(zip(
+                index_signeds, index_cnames, entry.get_buf_shapevars(), index_guards)):
+            if guard is True:
+                continue
+            if guard is not None:
+                code.putln("if (%s) {" % code.unlikely("!%s" % guard))
             if signed != 0:
                 # not unsigned, deal with negative index
                 code.putln("if (%s < 0) {" % cname)
@@ -464,6 +479,8 @@ def put_buffer_lookup_code(entry, index_signeds, index_cnames, directives,
             code.putln("if (%s) %s = %d;" % (
                 code.unlikely("%s >= %s%s" % (cname, cast, shape)),
                 failed_dim_temp, dim))
+            if guard is not None:
+                code.putln("}")
 
         if in_nogil_context:
             code.globalstate.use_utility_code(raise_indexerror_nogil)
@@ -479,10 +496,14 @@ def put_buffer_lookup_code(entry, index_signeds, index_cnames, directives,
         code.funcstate.release_temp(failed_dim_temp)
     elif negative_indices:
         # Only fix negative indices.
-        for signed, cname, shape in zip(index_signeds, index_cnames, entry.get_buf_shapevars()):
-            if signed != 0:
+        for signed, cname, shape, guard in zip(
+                index_signeds, index_cnames, entry.get_buf_shapevars(), index_guards):
+            # A guard flag is not cheaper to test than the sign.
+            if signed != 0 and guard is not True:
                 code.putln("if (%s < 0) %s += %s;" % (cname, cname, shape))
 
+    if hoisted_access is not None:
+        return entry.generate_buffer_lookup_code(code, index_cnames, hoisted_access)
     return entry.generate_buffer_lookup_code(code, index_cnames)
 
 
@@ -15,6 +15,8 @@ Cython language.  Cython is based on Pyrex by Greg Ewing.
 EPILOG = """
 Environment variables:
   CYTHON_CACHE_DIR: the base directory containing Cython's caches.
+  CYTHON_SERVER: the socket of a running compiler server to compile with
+                 (see "python -m Cython.Compiler.Server").
 """
 
 
@@ -137,6 +139,9 @@ def add_compile_arguments(parser, include_sources=True, for_shared=False):
                            'Level indicates aggressiveness, default 0 releases nothing.')
     parser.add_argument("--cache", dest='cache', action='store_true',
                       help='Enables Cython compilation cache.')
+    parser.add_argument("--cache-sharded", dest='cache_sharded', action='store_true',
+                      help='Use a sharded cache layout that is safe to share between '
+                           'concurrent processes and users (together with --cache).')
     parser.add_argument("-w", "--working", dest='working_path', action='store', type=str,
                       help='Sets the working directory for Cython (the directory modules are searched from)')
     parser.add_argument("--gdb", action=SetGDBDebugAction, nargs=0,
@@ -154,6 +159,10 @@ def add_compile_arguments(parser, include_sources=True, for_shared=False):
                       help='Annotate and include coverage information from cov.xml.')
     parser.add_argument("--line-directives", dest='emit_linenums', action='store_true',
                       help='Produce #line directives pointing to the .pyx source')
+    if not for_shared:
+        parser.add_argument("--split-output", dest='split_output', action='store', type=int, metavar='N',
+                          help='Distribute the generated function definitions over N C files that share '
+                               'an internal header, so that the C compiler can build them in parallel.')
     parser.add_argument("-+", "--cplus", dest='cplus', action='store_const', const=1,
                       help='Output a C++ rather than C file.')
     if not for_shared:
@@ -364,6 +373,9 @@ def parse_command_line(args):
     if Options.embed and len(sources) > 1:
         parser.error("cython: Only one source file allowed when using --embed\n")
 
+    if options.split_output and options.gdb_debug:
+        parser.error("cython: Cannot use --split-output with --gdb\n")
+
     if options.module_name:
         if options.timestamps:
             parser.error("cython: Cannot use --module-name with --timestamps\n")
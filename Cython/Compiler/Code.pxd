@@ -57,6 +57,8 @@ cdef class FunctionState:
     cdef public bint gil_owned
 
     cdef CCodeWriter temp_decl_writer
+    cdef public object outlined_code_writer
+    cdef public object parallel_thread_num
     cdef list[tuple] temps_allocated
     cdef dict[tuple, tuple] temps_free
     cdef dict[object, tuple] temps_used_type
@@ -65,7 +67,7 @@ cdef class FunctionState:
     cdef list[set[tuple]] collect_temps_stack
 
     cdef readonly object closure_temps
-    cdef bint should_declare_error_indicator
+    cdef public bint should_declare_error_indicator
     cdef public bint uses_error_indicator
     cdef public bint error_without_exception
     cdef public bint has_except_star
@@ -989,6 +989,8 @@ class FunctionState:
         self.gil_owned = True
 
         self.temp_decl_writer = None  # if set, insertion point for temp declarations
+        self.outlined_code_writer = None  # if set, insertion point for functions split off from the body
+        self.parallel_thread_num = None  # if set, thread number in the team of a thread pool
         self.temps_allocated = []  # of (name, type, manage_ref, static)
         self.temps_free = {}  # (type, manage_ref) -> list of free vars with same type/managed status
         self.temps_used_type = {}  # name -> (type, manage_ref)
@@ -1359,6 +1361,11 @@ class GlobalState:
     #
     # const_cnames_used  dict          global counter for unique constant identifiers
     # shared_utility_functions         List of parsed declaration lines of the shared utility functions
+    # split_output     int             number of C files that the module functions are distributed over
+    #                                  (0 or 1 for a single C file)
+    # split_functions  [(CCodeWriter, CCodeWriter)]
+    #                                  insertion point and separate writer of each outermost function
+    #                                  definition in split output mode
 
     # parts            {string:CCodeWriter}
 
@@ -1427,7 +1434,7 @@ class GlobalState:
         'end'
     ]
 
-    def __init__(self, writer, module_node, code_config, common_utility_include_dir=None):
+    def __init__(self, writer, module_node, code_config, common_utility_include_dir=None, split_output=0):
         self.filename_table = {}
         self.filename_list = []
         self.input_file_contents = {}
@@ -1436,6 +1443,7 @@ class GlobalState:
         self.in_utility_code_generation = False
         self.code_config = code_config
         self.common_utility_include_dir = common_utility_include_dir
+        self.split_output = split_output if split_output and split_output > 1 else 0
         self.parts = {}
         self.module_node = module_node  # because some utility code generation needs it
                                         # (generating backwards-compatible Get/ReleaseBuffer
@@ -1451,10 +1459,76 @@ class GlobalState:
         self.cached_cmethods = {}
         self.initialised_constants = set()
         self.shared_utility_functions = []
+        self.split_functions = []
+        self._split_function_writers = set()
 
         writer.set_global_state(self)
         self.rootwriter = writer
 
+    def module_linkage(self):
+        # Module level C functions and variables are "static", unless their
+        # definitions are distributed over several C files that reference each other.
+        return "__PYX_SPLIT_LINKAGE" if self.split_output else "static"
+
+    # Sections that end up in the internal header that all C files of a split module include.
+    # Everything else is only written to the main C file, except for the function definitions
+    # in 'module_code', which get distributed over all C files.
+    split_header_layout_end = 'module_state_clear'
+    split_header_tail = [
+        'utility_code_pragmas',
+        'utility_code_def',
+        'utility_code_pragmas_end',
+        'end'
+    ]
+
+    def split_function_writer(self, code):
+        """
+        Returns the writer for the definition of a module level function.
+
+        In split output mode, each outermost function definition (including its
+        Python wrapper and nested functions) gets a separate writer, so that it
+        can later be placed into any of the C files of the module.
+        """
+        if not self.split_output or id(code) in self._split_function_writers:
+            return code
+        writer = code.create_new(create_from=code, buffer=None, copy_formatting=True)
+        self.split_functions.append((code.insertion_point(), writer))
+        self._split_function_writers.add(id(writer))
+        return writer
+
+    def split_c_code(self):
+        """
+        Distributes the function definitions over the C files of a split module,
+        largest first, onto the file with the least code so far.
+        Returns the header code, the code of the main C file and a list of
+        function definition code for each additional C file.
+        """
+        header_end = self.code_layout.index(self.split_header_layout_end)
+        header_layout = self.code_layout[:header_end] + self.split_header_tail
+        main_layout = [part for part in self.code_layout if part not in header_layout]
+
+        functions = [(placeholder, writer.getvalue()) for placeholder, writer in self.split_functions]
+        main_size = sum(len(self.parts[part].getvalue()) for part in main_layout if part in self.parts)
+        file_sizes = [main_size] + [0] * (self.split_output - 1)
+        part_functions = [[] for _ in range(self.split_output - 1)]
+        # Sorting is stable, and ties go to the lowest file number, so that the distribution is deterministic.
+        for i in sorted(range(len(functions)), key=lambda i: -len(functions[i][1])):
+            placeholder, function_code = functions[i]
+            file_number = file_sizes.index(min(file_sizes))
+            file_sizes[file_number] += len(function_code)
+            if file_number == 0:
+                placeholder.insert(self.split_functions[i][1])
+            else:
+                part_functions[file_number - 1].append(i)
+
+        header_code = ''.join([self.parts[part].getvalue() for part in header_layout if part in self.parts])
+        main_code = ''.join([self.parts[part].getvalue() for part in main_layout if part in self.parts])
+        parts_code = [
+            ''.join([functions[i][1] for i in sorted(function_indices)])
+            for function_indices in part_functions
+        ]
+        return header_code, main_code, parts_code
+
     def initialize_main_c_code(self):
         rootwriter = self.rootwriter
         for i, part in enumerate(self.code_layout):
@@ -1590,7 +1664,7 @@ class GlobalState:
             w.exit_cfunc_scope()
 
     def put_pyobject_decl(self, entry):
-        self['global_var'].putln("static PyObject *%s;" % entry.cname)
+        self['global_var'].put_module_variable("PyObject *%s" % entry.cname)
 
     # constant handling at code generation time
 
@@ -2137,7 +2211,9 @@ class GlobalState:
             max_vars = max(max_vars, len(node.varnames))
             max_line = max(max_line, def_node.pos[1])
 
-        w.put(textwrap.dedent(f"""\
+        # The utility code that uses the struct is shared by all C files of a split module.
+        typedef_code = self.parts['decls'] if self.split_output else w
+        typedef_code.put(textwrap.dedent(f"""\
         #ifdef __cplusplus
         namespace {{
         #endif
@@ -2464,6 +2540,36 @@ def _write_escaped_cstring_const(code, cstring_bytes, c_var_name: str) -> cython
     _write_cstring_const(code, escaped_bytes, c_var_name, len(cstring_bytes))
 
 
+def write_common_include_file(include_dir, code, name):
+    """
+    Writes C code that does not depend on the module into a file in the common
+    utility include directory, named after its content, and returns its path
+    for use in an #include statement.
+    """
+    hash = hashlib.sha256(code.encode('utf8')).hexdigest()
+    include_file = f"{name}_{hash}.h"
+    path = os.path.join(include_dir, include_file)
+    if not os.path.exists(path):
+        tmp_path = f'{path}.tmp{os.getpid()}'
+        done = False
+        try:
+            with Utils.open_new_file(tmp_path) as f:
+                f.write(code)
+            shutil.move(tmp_path, path)
+            done = True
+        except (FileExistsError, PermissionError):
+            # If a different process created the file faster than us,
+            # renaming can fail on Windows.  It's ok if the file is there now.
+            if not os.path.exists(path):
+                raise
+        finally:
+            if not done and os.path.exists(tmp_path):
+                os.unlink(tmp_path)
+    # We use forward slashes in the include path to assure identical code generation
+    # under Windows and Posix.  C/C++ compilers should still understand it.
+    return path.replace('\\', '/')
+
+
 def funccontext_property(func):
     name = func.__name__
     attribute_of = operator.attrgetter(name)
@@ -2686,7 +2792,9 @@ class CCodeWriter:
                        guard=None):
         # Slot functions currently live in the class scope as they don't have direct access to the module state.
         slotfunc_cname = class_scope.mangle_internal(c_slot_name)
-        declaration = f"static {return_type.declaration_code(slotfunc_cname)}({args_signature})"
+        # Slot functions with a prototype can be called from functions in other C files of a split module.
+        linkage = self.globalstate.module_linkage() if needs_prototype else "static"
+        declaration = f"{linkage} {return_type.declaration_code(slotfunc_cname)}({args_signature})"
 
         if needs_prototype:
             if guard:
@@ -2841,28 +2949,7 @@ class CCodeWriter:
     def put_or_include(self, code, name):
         include_dir = self.globalstate.common_utility_include_dir
         if include_dir and len(code) > 1024:
-            hash = hashlib.sha256(code.encode('utf8')).hexdigest()
-            include_file = f"{name}_{hash}.h"
-            path = os.path.join(include_dir, include_file)
-            if not os.path.exists(path):
-                tmp_path = f'{path}.tmp{os.getpid()}'
-                done = False
-                try:
-                    with Utils.open_new_file(tmp_path) as f:
-                        f.write(code)
-                    shutil.move(tmp_path, path)
-                    done = True
-                except (FileExistsError, PermissionError):
-                    # If a different process created the file faster than us,
-                    # renaming can fail on Windows.  It's ok if the file is there now.
-                    if not os.path.exists(path):
-                        raise
-                finally:
-                    if not done and os.path.exists(tmp_path):
-                        os.unlink(tmp_path)
-            # We use forward slashes in the include path to assure identical code generation
-            # under Windows and Posix.  C/C++ compilers should still understand it.
-            c_path = path.replace('\\', '/')
+            c_path = write_common_include_file(include_dir, code, name)
             code = f'#include "{c_path}"\n'
         self.put_multilines(code)
 
@@ -2964,6 +3051,21 @@ class CCodeWriter:
         self.putln(";")
         self.globalstate.use_entry_utility_code(entry)
 
+    def put_module_variable(self, declaration, init=None):
+        # Module level C variables are "static", unless the module output is split,
+        # in which case they are defined in the main C file and "extern" in the others.
+        linkage = self.globalstate.module_linkage()
+        if self.globalstate.split_output:
+            self.putln("#ifdef __PYX_SPLIT_PART")
+            self.putln("extern %s %s;" % (linkage, declaration))
+            self.putln("#else")
+        self.put("%s %s" % (linkage, declaration))
+        if init is not None:
+            self.put_safe(" = %s" % init)
+        self.putln(";")
+        if self.globalstate.split_output:
+            self.putln("#endif")
+
     def put_temp_declarations(self, func_context: FunctionState):
         for name, type, manage_ref, static in func_context.temps_allocated:
             if type.is_cpp_class and not type.is_fake_reference and func_context.scope.directives['cpp_locals']:
@@ -3002,6 +3104,9 @@ class CCodeWriter:
             return cond
 
     def build_function_modifiers(self, modifiers, mapper=modifier_output_mapper):
+        if modifiers and self.globalstate.split_output:
+            # An inline function would need a definition in each C file that calls it.
+            modifiers = [m for m in modifiers if m != 'inline']
         if not modifiers:
             return ''
         return '%s ' % ' '.join([mapper(m,m) for m in modifiers])
@@ -3278,14 +3383,14 @@ class CCodeWriter:
             variable = '__pyx_gilstate_save'
         self.putln("__Pyx_PyGILState_Release(%s);" % variable)
 
-    def put_acquire_freethreading_lock(self):
+    def put_acquire_freethreading_lock(self, mutex_cname=Naming.parallel_freethreading_mutex):
         self.putln("#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING")
-        self.putln(f"PyMutex_Lock(&{Naming.parallel_freethreading_mutex});")
+        self.putln(f"PyMutex_Lock(&{mutex_cname});")
         self.putln("#endif")
 
-    def put_release_freethreading_lock(self):
+    def put_release_freethreading_lock(self, mutex_cname=Naming.parallel_freethreading_mutex):
         self.putln("#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING")
-        self.putln(f"PyMutex_Unlock(&{Naming.parallel_freethreading_mutex});")
+        self.putln(f"PyMutex_Unlock(&{mutex_cname});")
         self.putln("#endif")
 
     def put_acquire_gil(self, variable=None, unknown_gil_state=True):
@@ -188,11 +188,11 @@ def load_testscope_utility(cy_util_name, **kwargs):
 
 undecorated_methods_protos = UtilityCode(proto="""
     /* These methods are undecorated and have therefore no prototype */
-    static PyObject *__pyx_TestClass_cdef_method(
+    __PYX_SPLIT_LINKAGE PyObject *__pyx_TestClass_cdef_method(
             struct __pyx_TestClass_obj *self, int value);
-    static PyObject *__pyx_TestClass_cpdef_method(
+    __PYX_SPLIT_LINKAGE PyObject *__pyx_TestClass_cpdef_method(
             struct __pyx_TestClass_obj *self, int value, int skip_dispatch);
-    static PyObject *__pyx_TestClass_def_method(
+    __PYX_SPLIT_LINKAGE PyObject *__pyx_TestClass_def_method(
             PyObject *self, PyObject *value);
 """)
 
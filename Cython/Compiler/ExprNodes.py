@@ -26,7 +26,7 @@ import os.path
 import re
 import sys
 from collections import defaultdict
-from functools import partial
+from functools import partial, reduce
 from typing import Optional
 
 from .Errors import (
@@ -4123,6 +4123,10 @@ class ParallelThreadIdNode(AtomicExprNode):  #, Nodes.ParallelNode):
         return self
 
     def generate_result_code(self, code):
+        if code.funcstate.parallel_thread_num:
+            # inside of a section that runs in Cython's thread pool
+            code.putln("%s = %s;" % (self.temp_code, code.funcstate.parallel_thread_num))
+            return
         code.putln("#ifdef _OPENMP")
         code.putln("%s = omp_get_thread_num();" % self.temp_code)
         code.putln("#else")
@@ -4802,6 +4806,8 @@ class IndexNode(_IndexingBaseNode):
 
                     break
             else:
+                if self.base.type.fused_specializations:
+                    return error(self.pos, "Specialization was not selected by the fused_specializations directive")
                 # This is a bug
                 raise InternalError("Couldn't find the right signature")
 
@@ -5089,6 +5095,15 @@ class BufferIndexNode(_IndexingBaseNode):
     # Any indexing temp variables that we need to clean up.
     index_temps = ()
 
+    # Set by LoopIndexBoundsAnalysis for memoryview indexing inside of range() loops:
+    # one entry per index, None if it needs checking, True if it is known to be in bounds,
+    # or the ForFromStatNode whose index guard tells if it is in bounds.
+    index_bounds = None
+
+    # Set by MemoryViewAccessHoisting: the MemoryView.HoistedSliceAccess
+    # of the enclosing loop that calculates the leading part of the address.
+    hoisted_access = None
+
     def analyse_target_types(self, env):
         self.analyse_types(env, getting=False)
 
@@ -5167,13 +5182,33 @@ class BufferIndexNode(_IndexingBaseNode):
         """
         ndarray[1, 2, 3] and memslice[1, 2, 3]
         """
+        index_guards = None
+        if self.index_bounds:
+            index_guards = [
+                bound if bound is None or bound is True else bound.index_guard_cname
+                for bound in self.index_bounds]
+
         if self.in_nogil_context:
             if self.is_buffer_access or self.is_memview_index:
-                if code.globalstate.directives['boundscheck']:
+                if code.globalstate.directives['boundscheck'] and (index_guards is None or None in index_guards):
                     performance_hint(self.pos, "Use boundscheck(False) for faster access", code.globalstate)
 
         # Assign indices to temps of at least (s)size_t to allow further index calculations.
-        self.index_temps = index_temps = [self.get_index_in_temp(code,ivar) for ivar in self.indices]
+        hoisted_ndim = self.hoisted_access.ndim if self.hoisted_access is not None else 0
+        boundscheck = code.globalstate.directives['boundscheck']
+        index_cnames = []
+        self.index_temps = index_temps = []
+        for dim, ivar in enumerate(self.indices):
+            if dim < hoisted_ndim and not (boundscheck and (index_guards is None or index_guards[dim] is not True)):
+                # The hoisted row address already includes this index, and no bounds check needs it.
+                if index_guards is None:
+                    index_guards = [None] * len(self.indices)
+                index_guards[dim] = True
+                index_cnames.append(ivar.result())
+                continue
+            index_temp = self.get_index_in_temp(code, ivar)
+            index_temps.append(index_temp)
+            index_cnames.append(index_temp)
 
         # Generate buffer access code using these temps
         from . import Buffer
@@ -5186,11 +5221,13 @@ class BufferIndexNode(_IndexingBaseNode):
         return buffer_entry, Buffer.put_buffer_lookup_code(
             entry=buffer_entry,
             index_signeds=[ivar.type.signed for ivar in self.indices],
-            index_cnames=index_temps,
+            index_cnames=index_cnames,
             directives=code.globalstate.directives,
             pos=self.pos, code=code,
             negative_indices=negative_indices,
-            in_nogil_context=self.in_nogil_context)
+            in_nogil_context=self.in_nogil_context,
+            index_guards=index_guards,
+            hoisted_access=self.hoisted_access)
 
     def generate_assignment_code(self, rhs, code, overloaded_assignment=False):
         self.generate_subexpr_evaluation_code(code)
@@ -5429,7 +5466,9 @@ class MemoryViewSliceNode(MemoryViewIndexNode):
         return self
 
     def analyse_assignment(self, rhs):
-        if not rhs.type.is_memoryviewslice and (
+        if rhs.type.is_memoryview_expression:
+            return MemoryCopyExpression(self.pos, self)
+        elif not rhs.type.is_memoryviewslice and (
                 self.type.dtype.assignable_from(rhs.type) or
                 rhs.type.is_pyobject):
             # scalar assignment
@@ -5632,6 +5671,347 @@ class MemoryCopyScalar(MemoryCopyNode):
         code.end_block()
 
 
+class MemoryCopyExpression(MemoryCopyNode):
+    """
+    Assign an element-wise memoryview expression to a slice in a single loop.
+    If the slice overlaps with an operand in a different way than by being
+    the same view, the values are calculated into a temporary buffer first.
+
+        memslice1[...] = memslice2 * x + memslice3
+        memslice1[:] = memslice2 * x + memslice3
+    """
+
+    is_memview_copy_assignment = True
+
+    def _generate_assignment_code(self, expr, code):
+        from . import MemoryView
+
+        dst = self.dst
+        dst.type.assert_direct_dims(dst.pos)
+        type_decl = dst.type.dtype.empty_declaration_code()
+
+        code.begin_block()
+        if dst.result_in_temp() or dst.is_simple():
+            dst_temp = dst.result()
+        else:
+            code.putln("%s __pyx_temp_slice = %s;" % (dst.type.declaration_code(""), dst.result()))
+            dst_temp = "__pyx_temp_slice"
+
+        operands = expr.memoryview_operands()
+        loop = MemoryView.ElementLoop(
+            code, [(dst_temp, dst.type)] + [(operand.result(), operand.type) for operand in operands])
+        loop.put_declarations()
+        loop.put_extent_checks(self.pos, not self.in_nogil_context)
+
+        dst_pointer = loop.element_pointer(0)
+        divisors = []
+        value = expr.element_code(
+            ("(*%s)" % loop.element_pointer(i) for i in range(1, len(operands) + 1)), divisors)
+
+        code.globalstate.use_utility_code(MemoryView.overlapping_utility)
+        aliased = []
+        for operand in operands:
+            operand_type_decl = operand.type.dtype.empty_declaration_code()
+            same_view = " && ".join(
+                ["(sizeof(%s) == sizeof(%s))" % (type_decl, operand_type_decl),
+                 "(%s.data == %s.data)" % (dst_temp, operand.result())] +
+                ["(%s.strides[%d] == %s.strides[%d])" % (dst_temp, dim, operand.result(), dim)
+                 for dim in range(dst.type.ndim)])
+            aliased.append(
+                "(__pyx_slices_overlap(&%s, &%s, %d, (sizeof(%s) > sizeof(%s)) ? sizeof(%s) : sizeof(%s)) && !(%s))" % (
+                    dst_temp, operand.result(), dst.type.ndim,
+                    type_decl, operand_type_decl, type_decl, operand_type_decl,
+                    same_view))
+
+        code.putln("if (unlikely(%s)) {" % " || ".join(aliased))
+        code.globalstate.use_utility_code(UtilityCode.load_cached("IncludeStdlibH", "ModuleSetupCode.c"))
+        code.putln("%s *__pyx_temp_values = (%s *) malloc(sizeof(%s) * (size_t) (((%s) > 0) ? (%s) : 1));" % (
+            type_decl, type_decl, type_decl, loop.size_code(), loop.size_code()))
+        code.putln("%s *__pyx_temp_value;" % type_decl)
+        code.putln("if (unlikely(!__pyx_temp_values)) {")
+        if self.in_nogil_context:
+            code.put_ensure_gil()
+        code.putln("PyErr_NoMemory();")
+        if self.in_nogil_context:
+            code.put_release_ensured_gil()
+        code.putln(code.error_goto(self.pos))
+        code.putln("}")
+        code.putln("__pyx_temp_value = __pyx_temp_values;")
+        loop.start_loops()
+        put_zero_division_check(code, divisors, self.pos, self.in_nogil_context, "free(__pyx_temp_values);")
+        code.putln("*__pyx_temp_value++ = (%s) %s;" % (type_decl, value))
+        loop.end_loops()
+        code.putln("__pyx_temp_value = __pyx_temp_values;")
+        loop.start_loops()
+        code.putln("*%s = *__pyx_temp_value++;" % dst_pointer)
+        loop.end_loops()
+        code.putln("free(__pyx_temp_values);")
+        code.putln("} else {")
+        loop.start_loops()
+        put_zero_division_check(code, divisors, self.pos, self.in_nogil_context)
+        code.putln("*%s = (%s) %s;" % (dst_pointer, type_decl, value))
+        loop.end_loops()
+        code.putln("}")
+        code.end_block()
+
+
+def put_zero_division_check(code, divisors, pos, in_nogil, cleanup_code=None):
+    """
+    Raises ZeroDivisionError for the current element if one of the divisors
+    (C expressions) is zero, like '/' does for C numbers without cdivision.
+    """
+    if not divisors:
+        return
+    code.putln("if (unlikely(%s)) {" % " || ".join("((%s) == 0)" % divisor for divisor in divisors))
+    if cleanup_code:
+        code.putln(cleanup_code)
+    if in_nogil:
+        code.put_ensure_gil()
+    code.putln('PyErr_SetString(PyExc_ZeroDivisionError, "float division");')
+    if in_nogil:
+        code.put_release_ensured_gil()
+    code.putln(code.error_goto(pos))
+    code.putln("}")
+
+
+def is_elementwise_operand_type(type):
+    return type.is_memoryviewslice or type.is_memoryview_expression
+
+
+def is_elementwise_operation(operator, operand_types):
+    """
+    Element-wise operations are used between memoryview slices and C numbers.
+    Anything else, e.g. an object with an '__radd__()' method, keeps Python semantics.
+    """
+    if not any(is_elementwise_operand_type(operand_type) for operand_type in operand_types):
+        return False
+    if any(operand_type.is_pyobject for operand_type in operand_types):
+        return False
+    if operator in ('==', '!=') and not any(operand_type.is_memoryview_expression for operand_type in operand_types):
+        # Keep comparing plain memoryview slices as Python objects.
+        return False
+    return not memoryview_expression_type(operator, operand_types).is_error
+
+
+def memoryview_expression_type(operator, operand_types):
+    """
+    Returns the MemoryViewExpressionType of an element-wise operation
+    on memoryview slices and C numbers, or error_type if it is not supported.
+    """
+    ndim = None
+    element_types = []
+    for operand_type in operand_types:
+        if is_elementwise_operand_type(operand_type):
+            if ndim is not None and operand_type.ndim != ndim:
+                return error_type
+            ndim = operand_type.ndim
+            element_types.append(operand_type.dtype)
+        else:
+            element_types.append(operand_type)
+    if operator not in ElementwiseMemoryViewNode.operators[len(operand_types)]:
+        return error_type
+    if not all(element_type.is_int or element_type.is_float for element_type in element_types):
+        return error_type
+
+    if operator in ElementwiseMemoryViewNode.comparison_operators:
+        dtype = PyrexTypes.c_bint_type
+    else:
+        dtype = reduce(PyrexTypes.widest_numeric_type, element_types)
+        if operator == '/' and not dtype.is_float:
+            dtype = PyrexTypes.c_double_type
+    return PyrexTypes.MemoryViewExpressionType(dtype, ndim)
+
+
+class ElementwiseMemoryViewNode(ExprNode):
+    """
+    Element-wise arithmetic or comparison with memoryview slices, e.g. "a * x + b".
+
+    The node has no value of its own.  Slice assignments (MemoryCopyExpression)
+    and reductions (MemoryViewReductionNode) evaluate it element by element
+    in a single loop, without temporary arrays.
+
+        operator   string      the binary operator, or '-' or '+' with a single operand
+        operands   [ExprNode]  memoryview slices, C scalars or ElementwiseMemoryViewNodes
+    """
+    subexprs = ['operands']
+    zerodivision_check = False
+
+    comparison_operators = ('<', '<=', '>', '>=', '==', '!=')
+    operators = {
+        1: ('-', '+'),
+        2: ('+', '-', '*', '/') + comparison_operators,
+    }
+
+    def analyse_types(self, env):
+        # The operands are already analysed and supported, see is_elementwise_operation().
+        self.type = memoryview_expression_type(self.operator, [operand.type for operand in self.operands])
+        for i, operand in enumerate(self.operands):
+            if operand.type.is_memoryview_expression:
+                continue
+            if operand.type.is_memoryviewslice and not operand.type.assert_direct_dims(operand.pos):
+                self.type = error_type
+                return self
+            self.operands[i] = operand.coerce_to_simple(env)
+        if self.operator == '/' and not env.directives['cdivision']:
+            divisor = self.operands[1]
+            self.zerodivision_check = not divisor.has_constant_result() or divisor.constant_result == 0
+        return self
+
+    def coerce_to(self, dst_type, env):
+        if dst_type == self.type or self.type.is_error:
+            return self
+        if (self.is_memview_copy_assignment and dst_type.ndim == self.type.ndim
+                and (dst_type.dtype.is_int or dst_type.dtype.is_float)):
+            # MemoryCopyExpression converts each element
+            return self
+        error(self.pos, "Memoryview expressions can only be assigned to memoryview slices "
+                        "like 'result[:] = ...' or reduced with sum(), min() or max()")
+        self.type = error_type
+        return self
+
+    def memoryview_operands(self):
+        """
+        Returns all memoryview slices that the expression uses, in evaluation order.
+        """
+        operands = []
+        for operand in self.operands:
+            if operand.type.is_memoryview_expression:
+                operands.extend(operand.memoryview_operands())
+            elif operand.type.is_memoryviewslice:
+                operands.append(operand)
+        return operands
+
+    def element_code(self, elements, divisors=None):
+        """
+        Returns the C expression for the current element, given an iterable
+        over the C expressions of the elements of memoryview_operands().
+        The divisors that need a zero check are appended to the list 'divisors'.
+        """
+        elements = iter(elements)
+        codes = []
+        for operand in self.operands:
+            if operand.type.is_memoryview_expression:
+                codes.append(operand.element_code(elements, divisors))
+            elif operand.type.is_memoryviewslice:
+                codes.append(next(elements))
+            else:
+                codes.append(operand.result())
+        if len(codes) == 1:
+            return "(%s%s)" % (self.operator, codes[0])
+        if self.zerodivision_check and divisors is not None:
+            divisors.append(codes[1])
+        if self.operator == '/':
+            # true division, also for integer operands
+            return "(((%s) %s) / %s)" % (self.type.dtype.empty_declaration_code(), codes[0], codes[1])
+        return "(%s %s %s)" % (codes[0], self.operator, codes[1])
+
+    def generate_result_code(self, code):
+        # Evaluating the operands is all that is needed up front.
+        pass
+
+
+class MemoryViewReductionNode(ExprNode):
+    """
+    sum(), min() or max() of an element-wise memoryview expression or of a
+    one-dimensional memoryview slice, calculated in a single C loop.
+    Sums of floating point values are calculated in (at least) double precision,
+    like Python's sum() with compensation in Py3.12+, sums of integers in (at least) Py_ssize_t.
+    Integer expressions other than comparisons are not summed because they could overflow.
+
+        function   string     'sum', 'min' or 'max'
+        arg        ExprNode   ElementwiseMemoryViewNode or memoryview slice
+    """
+    subexprs = ['arg']
+    is_temp = True
+
+    def analyse_types(self, env):
+        # The argument is already analysed.
+        if self.arg.type.is_error:
+            self.type = error_type
+            return self
+        dtype = self.arg.type.dtype
+        if self.function == 'sum' and dtype.is_int and dtype is not PyrexTypes.c_bint_type:
+            # Python sums integers without overflow, counting comparisons cannot overflow.
+            error(self.pos, "sum() of integer memoryview expressions is not supported, "
+                            "because it could overflow unlike Python's sum()")
+            self.type = error_type
+            return self
+        if self.function == 'sum':
+            self.type = PyrexTypes.widest_numeric_type(
+                dtype, PyrexTypes.c_double_type if dtype.is_float else PyrexTypes.c_py_ssize_t_type)
+        else:
+            self.type = dtype
+        if self.arg.type.is_memoryviewslice:
+            if not self.arg.type.assert_direct_dims(self.arg.pos):
+                self.type = error_type
+                return self
+            self.arg = self.arg.coerce_to_simple(env)
+        return self
+
+    def generate_result_code(self, code):
+        from . import MemoryView
+
+        arg = self.arg
+        if arg.type.is_memoryview_expression:
+            operands = arg.memoryview_operands()
+        else:
+            operands = [arg]
+        result = self.result()
+
+        code.begin_block()
+        loop = MemoryView.ElementLoop(code, [(operand.result(), operand.type) for operand in operands])
+        loop.put_declarations()
+        loop.put_extent_checks(self.pos, not self.in_nogil_context)
+
+        divisors = []
+
+        def element_code(index_cnames=None, divisors=None):
+            elements = ("(*%s)" % loop.element_pointer(i, index_cnames) for i in range(len(operands)))
+            if arg.type.is_memoryview_expression:
+                return arg.element_code(elements, divisors)
+            return next(elements)
+
+        if self.function == 'sum':
+            # Follow the float summation of Python's sum(), which is compensated in Py3.12+.
+            compensated = self.type.same_as(PyrexTypes.c_double_type)
+            if compensated:
+                code.globalstate.use_utility_code(MemoryView.compensated_sum_utility)
+                code.putln("double __pyx_temp_compensation = 0;")
+            code.putln("%s = 0;" % result)
+            loop.start_loops()
+            value = element_code(divisors=divisors)
+            put_zero_division_check(code, divisors, self.pos, self.in_nogil_context)
+            if compensated:
+                code.putln("__pyx_compensated_sum_add(&%s, &__pyx_temp_compensation, %s);" % (
+                    result, value))
+            else:
+                code.putln("%s += %s;" % (result, value))
+            loop.end_loops()
+            if compensated:
+                code.putln("%s = __pyx_compensated_sum_result(%s, __pyx_temp_compensation);" % (
+                    result, result))
+        else:
+            code.putln("if (unlikely(%s)) {" % loop.empty_code())
+            if self.in_nogil_context:
+                code.put_ensure_gil()
+            code.putln('PyErr_SetString(PyExc_ValueError, "%s() arg is an empty sequence");' % self.function)
+            if self.in_nogil_context:
+                code.put_release_ensured_gil()
+            code.putln(code.error_goto(self.pos))
+            code.putln("}")
+            # The divisions always yield floating point values, so the first element
+            # can be calculated before the loop checks all divisors.
+            code.putln("%s = %s;" % (result, element_code(["0"] * loop.ndim)))
+            loop.start_loops()
+            value = element_code(divisors=divisors)
+            put_zero_division_check(code, divisors, self.pos, self.in_nogil_context)
+            code.putln("%s __pyx_temp_element = %s;" % (self.type.empty_declaration_code(), value))
+            code.putln("if (__pyx_temp_element %s %s) %s = __pyx_temp_element;" % (
+                '<' if self.function == 'min' else '>', result, result))
+            loop.end_loops()
+        code.end_block()
+
+
 class SliceIndexNode(ExprNode):
     #  2-element slice indexing
     #
@@ -6507,6 +6887,9 @@ class SimpleCallNode(CallNode):
                 type=PythranExpr(pythran_func_type(function, self.arg_tuple.args)),
             )
         elif func_type.is_pyobject:
+            reduction = self.analyse_as_memoryview_reduction(env)
+            if reduction is not None:
+                return reduction
             self.arg_tuple = TupleNode(self.pos, args = self.args)
             self.arg_tuple = self.arg_tuple.analyse_types(env).coerce_to_pyobject(env)
             self.args = None
@@ -6520,6 +6903,33 @@ class SimpleCallNode(CallNode):
 
         return self
 
+    def analyse_as_memoryview_reduction(self, env):
+        """
+        Returns a MemoryViewReductionNode for "sum(a * b)" etc. or None
+        """
+        function = self.function
+        if not (function.is_name and function.entry and function.entry.is_builtin
+                and function.name in ('sum', 'min', 'max')):
+            return None
+        if len(self.args) != 1 or self.args[0].is_starred:
+            return None
+        arg_type = self.args[0].infer_type(env)
+        if arg_type is None:
+            # e.g. Python 2 division of integers
+            return None
+        if arg_type.is_memoryviewslice:
+            # Python sums integers without overflow.
+            if arg_type.ndim != 1 or not (
+                    arg_type.dtype.is_float or arg_type.dtype.is_int and function.name != 'sum'):
+                return None
+        elif not arg_type.is_memoryview_expression:
+            return None
+        arg = self.args[0].analyse_types(env)
+        if not (arg.type.is_memoryview_expression or arg.type == arg_type):
+            self.args[0] = arg
+            return None
+        return MemoryViewReductionNode(self.pos, function=function.name, arg=arg).analyse_types(env)
+
     def analyse_c_function_call(self, env):
         func_type = self.function.type
         if func_type is error_type:
@@ -7156,7 +7566,11 @@ class PyMethodCallNode(CallNode):
     def select_utility_code(self, code):
         # ... and return the utility function's cname.
         if self.use_method_vectorcall:
-            if self.kwnames:
+            if code.globalstate.directives['optimize.cache_attribute_lookups']:
+                # Macro that declares a static cache for this call site.
+                name = "PyObjectVectorcallMethodCached"
+                cfunc = "__Pyx_Object_VectorcallMethodCached"
+            elif self.kwnames:
                 name = "PyObjectVectorcallMethodKwds"
                 cfunc = "__Pyx_Object_VectorcallMethodKwds"
             else:
@@ -7231,14 +7645,22 @@ class PyMethodCallNode(CallNode):
         elif kwdict:
             keyword_variable = kwdict.result()
 
-        code.putln(
-            f"{self.result()} = {function_caller}("
-            f"(PyObject*){function}, "
-            f"{Naming.callargs_cname}+{space_for_selfarg}, "
-            f"({len(args)+1:d}-{space_for_selfarg})"
-            f" | ({'1' if self.use_method_vectorcall else space_for_selfarg}*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET)"
-            f"{', ' if keyword_variable else ''}{keyword_variable}"
-            ");")
+        if function_caller == "__Pyx_Object_VectorcallMethodCached":
+            code.putln(
+                f"{function_caller}({self.result()}, "
+                f"{function}, "
+                f"{Naming.callargs_cname}+{space_for_selfarg}, "
+                f"({len(args)+1:d}-{space_for_selfarg}) | __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET, "
+                f"{keyword_variable or 'NULL'});")
+        else:
+            code.putln(
+                f"{self.result()} = {function_caller}("
+                f"(PyObject*){function}, "
+                f"{Naming.callargs_cname}+{space_for_selfarg}, "
+                f"({len(args)+1:d}-{space_for_selfarg})"
+                f" | ({'1' if self.use_method_vectorcall else space_for_selfarg}*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET)"
+                f"{', ' if keyword_variable else ''}{keyword_variable}"
+                ");")
 
         # Clean up.
 
@@ -8415,6 +8837,17 @@ class AttributeNode(ExprNode):
                 code.globalstate.use_utility_code(
                     UtilityCode.load_cached("PyObjectLookupSpecial", "ObjectHandling.c"))
                 lookup_func_name = '__Pyx_PyObject_LookupSpecial'
+            elif code.globalstate.directives['optimize.cache_attribute_lookups']:
+                code.globalstate.use_utility_code(
+                    UtilityCode.load_cached("PyObjectGetAttrStrCached", "ObjectHandling.c"))
+                code.putln(
+                    '__Pyx_PyObject_GetAttrStrCached(%s, %s, %s); %s' % (
+                        self.result(),
+                        self.obj.py_result(),
+                        code.intern_identifier(self.attribute),
+                        code.error_goto_if_null(self.result(), self.pos)))
+                self.generate_gotref(code)
+                return
             else:
                 code.globalstate.use_utility_code(
                     UtilityCode.load_cached("PyObjectGetAttrStr", "ObjectHandling.c"))
@@ -11761,6 +12194,8 @@ class UnopNode(ExprNode):
         return self.infer_unop_type(env, operand_type)
 
     def infer_unop_type(self, env, operand_type):
+        if self.is_memoryview_operation_type(operand_type):
+            return memoryview_expression_type(self.operator, [operand_type])
         if operand_type.is_pyobject and not operand_type.is_builtin_type:
             return py_object_type
         else:
@@ -11777,6 +12212,9 @@ class UnopNode(ExprNode):
         if self.is_pythran_operation(env):
             self.type = PythranExpr(pythran_unaryop_type(self.operator, self.operand.type))
             self.is_temp = 1
+        elif self.is_memoryview_operation_type(self.operand.type):
+            return ElementwiseMemoryViewNode(
+                self.pos, operator=self.operator, operands=[self.operand]).analyse_types(env)
         elif self.is_py_operation():
             self.coerce_operand_to_pyobject(env)
             self.type = py_object_type
@@ -11798,6 +12236,9 @@ class UnopNode(ExprNode):
         op_type = self.operand.type
         return np_pythran and (op_type.is_buffer or op_type.is_pythran_expr)
 
+    def is_memoryview_operation_type(self, operand_type):
+        return is_elementwise_operation(self.operator, [operand_type])
+
     def nogil_check(self, env):
         if self.is_py_operation():
             self.gil_error()
@@ -12820,6 +13261,10 @@ class BinopNode(ExprNode):
                                          self.operand2.type, env)
             assert self.type.is_pythran_expr
             self.is_temp = 1
+        elif self.is_memoryview_operation():
+            return ElementwiseMemoryViewNode(
+                self.pos, operator=self.operator,
+                operands=[self.operand1, self.operand2]).analyse_types(env)
         elif self.is_py_operation():
             self.coerce_operands_to_pyobjects(env)
             self.type = self.result_type(self.operand1.type,
@@ -12853,6 +13298,12 @@ class BinopNode(ExprNode):
                (is_pythran_supported_operation_type(type1) and is_pythran_supported_operation_type(type2)) and \
                (is_pythran_expr(type1) or is_pythran_expr(type2))
 
+    def is_memoryview_operation(self):
+        return self.is_memoryview_operation_types(self.operand1.type, self.operand2.type)
+
+    def is_memoryview_operation_types(self, type1, type2):
+        return is_elementwise_operation(self.operator, [type1, type2])
+
     def is_cpp_operation(self):
         return (self.operand1.type.is_cpp_class
             or self.operand2.type.is_cpp_class)
@@ -12883,6 +13334,8 @@ class BinopNode(ExprNode):
     def result_type(self, type1, type2, env):
         if self.is_pythran_operation_types(type1, type2, env):
             return PythranExpr(pythran_binop_type(self.operator, type1, type2))
+        if self.is_memoryview_operation_types(type1, type2):
+            return memoryview_expression_type(self.operator, [type1, type2])
         if self.is_py_operation_types(type1, type2):
             if type2.is_string:
                 type2 = Builtin.bytes_type
@@ -13436,6 +13889,14 @@ class DivNode(NumBinopNode):
             self.operand1.infer_type(env),
             self.operand2.infer_type(env), env)
 
+    def is_memoryview_operation_types(self, type1, type2):
+        if self.operator == '/' and not self.truedivision:
+            # Python 2 division is only a true division for floating point operands.
+            element_types = [type.dtype if is_elementwise_operand_type(type) else type for type in (type1, type2)]
+            if not any(element_type.is_float for element_type in element_types):
+                return False
+        return super().is_memoryview_operation_types(type1, type2)
+
     def infer_builtin_types_operation(self, type1, type2):
         result_type = super().infer_builtin_types_operation(type1, type2)
         if result_type is not None and self.operator == '/':
@@ -13453,6 +13914,8 @@ class DivNode(NumBinopNode):
     def analyse_operation(self, env):
         self._check_truedivision(env)
         result = NumBinopNode.analyse_operation(self, env)
+        if result.type.is_memoryview_expression:
+            return result
 
         # The assumption here is that result is either 'self' or a coercion
         # node containing 'self'. Thus it is reasonable to keep manipulating
@@ -13620,6 +14083,8 @@ class ModNode(DivNode):
 
     def analyse_operation(self, env):
         result = DivNode.analyse_operation(self, env)
+        if result.type.is_memoryview_expression:
+            return result
         # The assumption here is that result is either 'self' or a coercion
         # node containing 'self'. Thus it is reasonable to keep manipulating
         # 'self' even if it's been replaced as the eventual result.
@@ -14660,6 +15125,9 @@ class PrimaryCmpNode(ExprNode, CmpNode):
             if is_pythran_supported_type(type1) and is_pythran_supported_type(type2):
                 return PythranExpr(pythran_binop_type(self.operator, type1, type2))
 
+        if not self.cascade and is_elementwise_operation(self.operator, [type1, type2]):
+            return memoryview_expression_type(self.operator, [type1, type2])
+
         # TODO: implement this for other types.
         return py_object_type
 
@@ -14699,6 +15167,11 @@ class PrimaryCmpNode(ExprNode, CmpNode):
         if self.analyse_memoryviewslice_comparison(env):
             return self
 
+        if not self.cascade and is_elementwise_operation(self.operator, [type1, type2]):
+            return ElementwiseMemoryViewNode(
+                self.pos, operator=self.operator,
+                operands=[self.operand1, self.operand2]).analyse_types(env)
+
         if self.cascade:
             self.cascade = self.cascade.analyse_types(env)
 
@@ -35,6 +35,15 @@ class FusedCFuncDefNode(StatListNode):
                             specializations
 
     fused_compound_types    All fused (compound) types (e.g. floating[:])
+    dispatch_args           Bit mask of the argument positions that select the
+                            specialisation, for the dispatch cache of the fused
+                            function (0 if the dispatch cannot be cached)
+    dispatch_buffer_args    Bit mask of the positions in dispatch_args that
+                            select a buffer specialisation
+    merged_signatures       List of (signature, signature) pairs of the
+                            specializations that were merged into an identical one
+    specialized_type_names  Dict mapping each fused base type to the names of its
+                            specific types that were kept after pruning
     """
 
     __signatures__ = None
@@ -43,6 +52,10 @@ class FusedCFuncDefNode(StatListNode):
     py_func = None
     defaults_tuple = None
     decorators = None
+    dispatch_args = 0
+    dispatch_buffer_args = 0
+    merged_signatures = ()
+    specialized_type_names = None
 
     child_attrs = StatListNode.child_attrs + [
         '__signatures__', 'resulting_fused_function', 'fused_func_assignment']
@@ -84,7 +97,8 @@ class FusedCFuncDefNode(StatListNode):
         fused_compound_types = PyrexTypes.unique(
             [arg.type for arg in self.node.args if arg.type.is_fused])
         fused_types = self._get_fused_base_types(fused_compound_types)
-        permutations = PyrexTypes.get_all_specialized_permutations(fused_types)
+        permutations = self.select_permutations(
+            fused_types, self.node.local_scope.directives.get('fused_specializations'))
 
         self.fused_compound_types = fused_compound_types
 
@@ -124,10 +138,15 @@ class FusedCFuncDefNode(StatListNode):
         Create a copy of the original c(p)def function for all specialized
         versions.
         """
-        permutations = self.node.type.get_all_specialized_permutations()
-        # print 'Node %s has %d specializations:' % (self.node.entry.name,
-        #                                            len(permutations))
-        # import pprint; pprint.pprint([d for cname, d in permutations])
+        signatures = self.node.type.fused_specializations
+        declared_type = self.node.entry.type
+        if declared_type is not self.node.type and declared_type.is_cfunction:
+            # The .pxd declaration determines the specializations that other modules cimport.
+            if signatures and list(signatures) != list(declared_type.fused_specializations):
+                error(self.node.pos,
+                      "fused_specializations of '%s' must be declared in its .pxd file" % self.node.entry.name)
+            signatures = declared_type.fused_specializations
+        permutations = self.select_permutations(self.node.type.get_fused_types(), signatures)
 
         # Prevent copying of the python function
         self.orig_py_func = orig_py_func = self.node.py_func
@@ -213,6 +232,43 @@ class FusedCFuncDefNode(StatListNode):
         else:
             self.py_func = orig_py_func
 
+    def select_permutations(self, fused_types, signatures):
+        """
+        Return the permutations of the fused types that get specialized,
+        after applying the 'fused_specializations' directive and merging
+        the permutations that would generate identical code.
+        """
+        all_permutations = PyrexTypes.get_all_specialized_permutations(fused_types)
+        permutations, self.merged_signatures, unknown = PyrexTypes.select_specialized_permutations(
+            fused_types, all_permutations, signatures)
+
+        if unknown:
+            error(self.node.pos, "Unknown fused specialization%s %s, expected one of: %s" % (
+                's' if len(unknown) > 1 else '',
+                ', '.join(["'%s'" % signature for signature in unknown]),
+                ', '.join([PyrexTypes.get_permutation_signature(fused_types, f2s)
+                           for _, f2s in all_permutations])))
+        if not permutations:
+            # Nothing valid was selected, continue with all specializations to avoid follow-up errors.
+            permutations = all_permutations
+
+        self.specialized_type_names = type_names = {}
+        for _, f2s in permutations:
+            for fused_type, specific_type in f2s.items():
+                type_names.setdefault(fused_type, set()).add(specific_type.typeof_name())
+
+        if self.node.local_scope.directives['show_fused_specializations']:
+            fused_types = PyrexTypes.unique(fused_types)
+            note = "Fused function '%s' has %d of %d specializations: %s" % (
+                self.node.entry.name, len(permutations), len(all_permutations),
+                ', '.join([PyrexTypes.get_permutation_signature(fused_types, f2s) for _, f2s in permutations]))
+            if self.merged_signatures:
+                note += "; merged %s" % ', '.join([
+                    "%s into %s" % merged for merged in self.merged_signatures])
+            Errors.message(self.node.pos, note)
+
+        return permutations
+
     def _get_fused_base_types(self, fused_compound_types):
         """
         Get a list of unique basic fused types, from a list of
@@ -559,11 +615,16 @@ class FusedCFuncDefNode(StatListNode):
                             {dtype_name}_is_signed = not (<{dtype_type}> -1 > 0)
                         """)
 
-    def _split_fused_types(self, arg):
+    def _split_fused_types(self, arg, fused_type):
         """
         Specialize fused types and split into normal types and buffer types.
         """
         specialized_types = PyrexTypes.get_specialized_types(arg.type)
+        type_names = self.specialized_type_names[fused_type]
+        specialized_types = [
+            specialized_type for specialized_type in specialized_types
+            if specialized_type.specialization_string in type_names
+        ]
 
         # Prefer long over int, etc by sorting (see type classes in PyrexTypes.py)
         specialized_types.sort()
@@ -588,6 +649,11 @@ class FusedCFuncDefNode(StatListNode):
 
         return normal_types, buffer_types, pythran_types, has_object_fallback
 
+    def _is_strided_buffer(self, buffer_type):
+        if buffer_type.is_buffer:
+            return True
+        return all(axis == ('direct', 'strided') for axis in buffer_type.axes)
+
     def _unpack_argument(self, pyx_code, arg, arg_tuple_idx, min_positional_args, default_idx, env):
         pyx_code.put_chunk(
             f"""
@@ -665,6 +731,8 @@ class FusedCFuncDefNode(StatListNode):
         default_idx = 0
         all_buffer_types = OrderedSet()
         seen_fused_types = set()
+        dispatch_args = dispatch_buffer_args = 0
+        dispatch_cacheable = True
         for i, arg in enumerate(self.node.args):
             if arg.type.is_fused:
                 arg_fused_types = arg.type.get_fused_types()
@@ -676,9 +744,16 @@ class FusedCFuncDefNode(StatListNode):
             if arg.type.is_fused and fused_type not in seen_fused_types:
                 seen_fused_types.add(fused_type)
 
-                normal_types, buffer_types, pythran_types, has_object_fallback = self._split_fused_types(arg)
+                normal_types, buffer_types, pythran_types, has_object_fallback = self._split_fused_types(arg, fused_type)
                 self._unpack_argument(pyx_code, arg, i, min_positional_args, default_idx, env)
 
+                dispatch_args |= 1 << i
+                if buffer_types:
+                    dispatch_buffer_args |= 1 << i
+                if pythran_types or not all(self._is_strided_buffer(ty) for ty in buffer_types):
+                    # The match depends on the strides of the buffer, not only on its type and format.
+                    dispatch_cacheable = False
+
                 mapper_arg_types = ['object', 'type']
                 mapper_arg_names = ['arg']
                 if buffer_types or pythran_types:
@@ -746,6 +821,10 @@ class FusedCFuncDefNode(StatListNode):
             if arg.default:
                 default_idx += 1
 
+        if dispatch_cacheable and dispatch_args < (1 << 32) and len(seen_fused_types) <= 4:
+            self.dispatch_args = dispatch_args
+            self.dispatch_buffer_args = dispatch_buffer_args
+
         if all_buffer_types:
             env.use_utility_code(
                 Code.UtilityCode.load_cached("IsLittleEndian", "ModuleSetupCode.c"))
@@ -950,11 +1029,25 @@ class FusedCFuncDefNode(StatListNode):
         if self.__signatures__:
             signatures = self.__signatures__
             signatures.generate_evaluation_code(code)
+            for merged_signature, signature in self.merged_signatures:
+                # Merged specializations share the function object of the one they were merged into.
+                merged_key = code.get_py_string_const(StringEncoding.EncodedString(merged_signature))
+                key = code.get_py_string_const(StringEncoding.EncodedString(signature))
+                code.put_error_if_neg(
+                    self.pos,
+                    f"PyDict_SetItem({signatures.result()}, {merged_key}, PyDict_GetItem({signatures.result()}, {key}))")
             fused_func = self.resulting_fused_function
             fused_func.generate_evaluation_code(code)
 
             code.putln(
                 f"__Pyx_as_FusedFunctionObject({fused_func.result()})->__signatures__ = {signatures.result()};")
+            if self.dispatch_args:
+                code.putln(
+                    f"__Pyx_as_FusedFunctionObject({fused_func.result()})->dispatch_args = {self.dispatch_args:#x}U;")
+                if self.dispatch_buffer_args:
+                    code.putln(
+                        f"__Pyx_as_FusedFunctionObject({fused_func.result()})->dispatch_buffer_args = "
+                        f"{self.dispatch_buffer_args:#x}U;")
 
             signatures.generate_giveref(code)
             signatures.generate_post_assignment_code(code)
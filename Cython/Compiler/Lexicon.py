@@ -12,7 +12,12 @@ any_string_prefix = raw_prefixes + string_prefixes + char_prefixes
 IDENT = 'IDENT'
 
 
-def make_lexicon():
+def make_lexicon(tables=None):
+    """
+    Build the lexicon of the Cython scanner.  If 'tables' are passed
+    (see load_lexicon_tables()) and match the lexicon specification,
+    they are used instead of building the DFA.
+    """
     from ..Plex import \
         Str, Any, AnyBut, Rep, Rep1, Opt, Bol, Eol, Eof, \
         TEXT, IGNORE, Method, State, Lexicon, Range
@@ -224,9 +229,60 @@ def make_lexicon():
         # FIXME: Plex 1.9 needs different args here from Plex 1.1.4
         #debug_flags = scanner_debug_flags,
         #debug_file = scanner_dump_file
+        tables=tables,
         )
 
 
+def load_lexicon_tables():
+    """
+    Return the state tables that were written by write_lexicon_tables()
+    at build time, or None if there are none.
+    """
+    try:
+        from .LexiconTables import tables
+    except ImportError:
+        return None
+    return tables
+
+
+def write_lexicon_tables(file_path):
+    """
+    Write the state tables of the lexicon into a Python module, from which
+    they can be loaded instead of building the DFA at runtime.
+    Returns True if the file was changed.
+    """
+    import textwrap
+    from ..Utils import write_file_if_changed
+
+    def format_ints(values):
+        return textwrap.fill(', '.join(map(str, values)), width=100, initial_indent=' ' * 8, subsequent_indent=' ' * 8)
+
+    fingerprint, initial_states, state_actions, class_bounds, bound_classes, num_classes, table = \
+        make_lexicon().serialize_tables()
+    table_rows = [table[i:i + num_classes] for i in range(0, len(table), num_classes)]
+
+    code = [
+        "# Generated by Cython.Compiler.Lexicon.write_lexicon_tables(), do not edit.",
+        "# make_lexicon() ignores these tables if they do not match the lexicon specification.",
+        "",
+        "tables = (",
+        "    %r," % fingerprint,
+        "    %r," % initial_states,
+        "    # action index of each state",
+        "    (\n%s\n    )," % format_ints(state_actions),
+        "    # first character code of each range of characters",
+        "    (\n%s\n    )," % format_ints(class_bounds),
+        "    # character class of each range of characters",
+        "    (\n%s\n    )," % format_ints(bound_classes),
+        "    %d," % num_classes,
+        "    # next state for each character class (and BOL, EOL, EOF) of each state",
+        "    (\n%s\n    )," % ',\n'.join([format_ints(row) for row in table_rows]),
+        ")",
+        "",
+    ]
+    return write_file_if_changed(file_path, '\n'.join(code))
+
+
 # BEGIN GENERATED CODE
 # Generated with 'cython-generate-lexicon.py' based on Unicode 17.0.0:
 # cpython 3.15.0a2+ free-threading build (heads/master:9c4ff8a615a, Nov 27 2025, 14:45:58) [GCC 13.3.0]
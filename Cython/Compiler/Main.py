@@ -729,9 +729,8 @@ def compile(source, options = None, full_module_name = None, **kwds):
             if options.verbose:
                 sys.stderr.write('Cache is ignored when annotations are enabled.\n')
         else:
-            from ..Build.Cache import Cache
-            cache_path = None if options.cache is True else options.cache
-            cache = Cache(cache_path)
+            from ..Build.Cache import create_cache
+            cache = create_cache(options)
 
     if isinstance(source, str):
         if not options.timestamps:
@@ -818,6 +817,12 @@ def search_module_in_dir(package_dir, module_name, suffix):
 # ------------------------------------------------------------------------
 
 def setuptools_main():
+    server_socket = os.environ.get('CYTHON_SERVER')
+    if server_socket and hasattr(os, 'fork'):
+        from .Server import run_client
+        exit_code = run_client(server_socket, sys.argv[1:])
+        if exit_code is not None:
+            sys.exit(exit_code)
     return main(command_line = 1)
 
 
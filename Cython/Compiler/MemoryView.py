@@ -203,22 +203,31 @@ class MemoryViewSliceBufferEntry(Buffer.BufferEntry):
     def get_buf_shapevars(self):
         return self._for_all_ndim("%s.shape[%d]")
 
-    def generate_buffer_lookup_code(self, code, index_cnames):
+    def generate_buffer_lookup_code(self, code, index_cnames, hoisted_access=None):
         axes = [(dim, index_cnames[dim], access, packing)
                     for dim, (access, packing) in enumerate(self.type.axes)]
-        return self._generate_buffer_lookup_code(code, axes)
+        if hoisted_access is None:
+            return self._generate_buffer_lookup_code(code, axes)
+        return self._generate_buffer_lookup_code(
+            code, axes[hoisted_access.ndim:],
+            bufp=hoisted_access.row_cname, strides=hoisted_access.stride_cnames)
 
-    def _generate_buffer_lookup_code(self, code, axes, cast_result=True):
+    def _generate_buffer_lookup_code(self, code, axes, cast_result=True, bufp=None, strides=None):
         """
         Generate a single expression that indexes the memory view slice
-        in each dimension.
+        in each dimension.  'bufp' and 'strides' optionally replace the data
+        pointer and the strides (by dimension) of the slice struct.
         """
-        bufp = self.buf_ptr
+        if bufp is None:
+            bufp = self.buf_ptr
         type_decl = self.type.dtype.empty_declaration_code()
 
         for dim, index, access, packing in axes:
             shape = "%s.shape[%d]" % (self.cname, dim)
-            stride = "%s.strides[%d]" % (self.cname, dim)
+            if strides and dim in strides:
+                stride = strides[dim]
+            else:
+                stride = "%s.strides[%d]" % (self.cname, dim)
             suboffset = "%s.suboffsets[%d]" % (self.cname, dim)
 
             flag = get_memoryview_flag(access, packing)
@@ -362,6 +371,56 @@ class MemoryViewSliceBufferEntry(Buffer.BufferEntry):
             code.funcstate.release_temp(suboffset_dim_temp[0])
 
 
+class HoistedSliceAccess:
+    """
+    Memoryview indexing inside of a loop that neither modifies the memoryview
+    nor its leading indices.  The loop calculates the address of the indexed
+    row and copies the remaining strides into local variables before its first
+    iteration, so that the indexing only adds the offsets of the other indices
+    and the C compiler does not have to reload the slice struct after stores.
+
+    The row address uses the same wraparound as the indexing itself, which still
+    checks the bounds of all indices before dereferencing it.  Indices that are
+    known to be within bounds need no wraparound.
+    """
+    row_cname = None
+
+    def __init__(self, base, indices, wraparound):
+        self.base = base  # NameNode of the memoryview
+        self.indices = indices  # the leading index nodes (names or literals)
+        self.ndim = len(indices)
+        self.wraparound = wraparound  # for each index, if it might be negative and needs wraparound
+        self.stride_cnames = {}
+
+    def generate_hoisting_code(self, code):
+        entry = self.base.type.get_entry(self.base)
+        axes = []
+        for dim, (index, (access, packing)) in enumerate(zip(self.indices, self.base.type.axes)):
+            # Literal indices are not evaluated yet before the loop.
+            index_code = index.get_constant_c_result_code() if index.is_literal else index.result()
+            if self.wraparound[dim]:
+                index_code = "(%s < 0 ? %s + %s.shape[%d] : %s)" % (
+                    index_code, index_code, entry.cname, dim, index_code)
+            axes.append((dim, index_code, access, packing))
+
+        self.row_cname = code.funcstate.allocate_temp(PyrexTypes.c_char_ptr_type, manage_ref=False)
+        code.putln("%s = %s;" % (
+            self.row_cname, entry._generate_buffer_lookup_code(code, axes, cast_result=False)))
+
+        for dim in range(self.ndim, self.base.type.ndim):
+            if get_memoryview_flag(*self.base.type.axes[dim]) == 'strided':
+                stride_cname = code.funcstate.allocate_temp(PyrexTypes.c_py_ssize_t_type, manage_ref=False)
+                code.putln("%s = %s.strides[%d];" % (stride_cname, entry.cname, dim))
+                self.stride_cnames[dim] = stride_cname
+
+    def release(self, code):
+        code.funcstate.release_temp(self.row_cname)
+        for stride_cname in self.stride_cnames.values():
+            code.funcstate.release_temp(stride_cname)
+        self.row_cname = None
+        self.stride_cnames = {}
+
+
 def empty_slice(pos):
     none = ExprNodes.NoneNode(pos)
     return ExprNodes.SliceNode(pos, start=none,
@@ -429,6 +488,89 @@ def get_is_contig_utility(contig_type, ndim):
     return utility
 
 
+class ElementLoop:
+    """
+    Generates nested C loops over all elements of memoryview slices
+    that have the same shape, e.g. to evaluate element-wise expressions.
+    The first slice determines the shape.  The data pointers and strides
+    are copied into local variables, so that the C compiler can keep them
+    in registers and vectorise the loops.
+
+    Must be used inside of a C block.
+
+        slices    [(result code, MemoryViewSliceType)]
+    """
+    def __init__(self, code, slices):
+        self.code = code
+        self.slices = slices
+        self.ndim = slices[0][1].ndim
+        self.index_cnames = ["__pyx_temp_idx_%d" % dim for dim in range(self.ndim)]
+        self.extent_cnames = ["__pyx_temp_extent_%d" % dim for dim in range(self.ndim)]
+        self.stride_cnames = []
+        for i, (_, slice_type) in enumerate(slices):
+            self.stride_cnames.append({
+                dim: "__pyx_temp_stride_%d_%d" % (i, dim)
+                for dim, axis in enumerate(slice_type.axes)
+                if get_memoryview_flag(*axis) == 'strided'})
+
+    def put_declarations(self):
+        code = self.code
+        shape_slice = self.slices[0][0]
+        for dim in range(self.ndim):
+            code.putln("Py_ssize_t %s = %s.shape[%d];" % (self.extent_cnames[dim], shape_slice, dim))
+            code.putln("Py_ssize_t %s;" % self.index_cnames[dim])
+        for i, (slice_result, _) in enumerate(self.slices):
+            code.putln("char *__pyx_temp_data_%d = %s.data;" % (i, slice_result))
+            for dim, stride_cname in self.stride_cnames[i].items():
+                code.putln("Py_ssize_t %s = %s.strides[%d];" % (stride_cname, slice_result, dim))
+
+    def put_extent_checks(self, pos, have_gil):
+        code = self.code
+        if len(self.slices) < 2:
+            return
+        code.globalstate.use_utility_code(check_extents_utility)
+        shape_slice = self.slices[0][0]
+        for slice_result, _ in self.slices[1:]:
+            code.putln(code.error_goto_if_neg(
+                "__pyx_memviewslice_check_extents(%s.shape, %s.shape, %d, %d)" % (
+                    shape_slice, slice_result, self.ndim, have_gil),
+                pos))
+
+    def size_code(self):
+        return " * ".join(self.extent_cnames)
+
+    def empty_code(self):
+        return " || ".join("(%s == 0)" % extent for extent in self.extent_cnames)
+
+    def element_pointer(self, i, index_cnames=None):
+        """
+        Returns a typed pointer to the current element of the i-th slice,
+        or to the element at 'index_cnames'.
+        """
+        from . import Symtab
+        slice_result, slice_type = self.slices[i]
+        if index_cnames is None:
+            index_cnames = self.index_cnames
+        entry = MemoryViewSliceBufferEntry(Symtab.Entry(slice_result, slice_result, slice_type))
+        axes = [(dim, index, access, packing)
+                for dim, (index, (access, packing)) in enumerate(zip(index_cnames, slice_type.axes))]
+        return entry._generate_buffer_lookup_code(
+            self.code, axes, bufp="__pyx_temp_data_%d" % i, strides=self.stride_cnames[i])
+
+    def start_loops(self):
+        # Loop in memory order of the first slice.
+        dims = range(self.ndim)
+        if self.ndim > 1 and self.slices[0][1].is_f_contig:
+            dims = reversed(dims)
+        for dim in dims:
+            self.code.putln("for (%s = 0; %s < %s; %s++) {" % (
+                self.index_cnames[dim], self.index_cnames[dim], self.extent_cnames[dim], self.index_cnames[dim]))
+
+    def end_loops(self):
+        for _ in range(self.ndim):
+            self.code.putln("}")
+
+
 def slice_iter(slice_type, slice_result, ndim, code, force_strided=False):
     if (slice_type.is_c_contig or slice_type.is_f_contig) and not force_strided:
         return ContigSliceIter(slice_type, slice_result, ndim, code)
@@ -873,6 +1015,10 @@ def get_typeinfo_to_format_code(shared_utility_qualified_name):
 
 is_contig_utility = load_memview_c_utility("MemviewSliceIsContig")
 overlapping_utility = load_memview_c_utility("OverlappingSlices")
+parallel_copy_utility = load_memview_c_utility("MemviewParallelCopy")
+array_allocation_utility = load_memview_c_utility("ArrayAllocation")
+check_extents_utility = load_memview_c_utility("MemviewSliceCheckExtents")
+compensated_sum_utility = load_memview_c_utility("MemviewCompensatedSum")
 refcount_utility = load_memview_c_utility("MemviewRefcount")
 slice_init_utility = load_memview_c_utility("MemviewSliceInit")
 memviewslice_declare_code = load_memview_c_utility("MemviewSliceStruct", context=template_context)
@@ -893,6 +1039,8 @@ def _get_memoryview_utility_code():
                     atomic_utility,
                     is_contig_utility,
                     overlapping_utility,
+                    parallel_copy_utility,
+                    array_allocation_utility,
                     copy_contents_new_utility,
                     slice_memviewslice_utility,
                     ],
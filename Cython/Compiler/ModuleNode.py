@@ -35,7 +35,9 @@ from . import Pythran
 
 from .Errors import error, warning, CompileError
 from .PyrexTypes import py_object_type
-from ..Utils import open_new_file, replace_suffix, decode_filename, build_hex_version, is_cython_generated_file
+from ..Utils import (
+    open_new_file, write_file_if_changed, replace_suffix, split_output_files, decode_filename,
+    build_hex_version, is_cython_generated_file, GENERATED_BY_MARKER)
 from .Code import UtilityCode, IncludeCode, TempitaUtilityCode
 from .StringEncoding import EncodedString, bytes_literal, encoded_string_or_bytes_literal
 from .Pythran import has_np_pythran
@@ -592,6 +594,7 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
             rootwriter, self,
             code_config=c_code_config,
             common_utility_include_dir=options.common_utility_include_dir,
+            split_output=options.split_output,
         )
         globalstate.initialize_main_c_code()
         h_code = globalstate['h_code']
@@ -608,7 +611,11 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
                    self.full_module_name.as_c_string_literal())
         module_is_main = self.is_main_module_flag_cname()
         code.putln("extern int %s;" % module_is_main)
+        if globalstate.split_output:
+            code.putln("#ifndef __PYX_SPLIT_PART")
         code.putln("int %s = 0;" % module_is_main)
+        if globalstate.split_output:
+            code.putln("#endif")
         code.putln("")
         code.putln("/* Implementation of %s */" % env.qualified_name.as_c_string_literal())
 
@@ -666,17 +673,38 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
 
         self.generate_module_state_end(env, modules, globalstate)
 
-        f = open_new_file(result.c_file)
-        try:
-            rootwriter.copyto(f)
-        finally:
-            f.close()
+        if globalstate.split_output:
+            self.write_split_c_files(globalstate, result.c_file)
+        else:
+            f = open_new_file(result.c_file)
+            try:
+                rootwriter.copyto(f)
+            finally:
+                f.close()
         result.c_file_generated = 1
         if options.gdb_debug:
             self._serialize_lineno_map(env, rootwriter)
         if Options.annotate or options.annotate:
             self._generate_annotations(rootwriter, result, options)
 
+    def write_split_c_files(self, globalstate, c_file):
+        header_file, part_files = split_output_files(c_file, globalstate.split_output)
+        for path in [header_file] + part_files:
+            self.assure_safe_target(path, allow_failed=True)
+        header_code, main_code, parts_code = globalstate.split_c_code()
+
+        # Unchanged headers and parts keep their timestamps to avoid recompiling them.
+        write_file_if_changed(header_file, header_code)
+
+        include = '#include "%s"\n' % os.path.basename(header_file)
+        for part_file, part_code in zip(part_files, parts_code):
+            write_file_if_changed(part_file, "%s\n\n#define __PYX_SPLIT_PART 1\n%s\n%s" % (
+                GENERATED_BY_MARKER, include, part_code))
+
+        # The main C file is always rewritten, its timestamp shows that the module is up to date.
+        with open_new_file(c_file) as f:
+            f.write("%s\n\n%s\n%s" % (GENERATED_BY_MARKER, include, main_code))
+
     def _generate_annotations(self, rootwriter, result, options):
         self.annotate(rootwriter)
 
@@ -892,41 +920,67 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
             code.putln("END: Cython Metadata */")
             code.putln("")
 
-        code.putln("#ifndef PY_SSIZE_T_CLEAN")
-        code.putln("#define PY_SSIZE_T_CLEAN")
-        code.putln("#endif /* PY_SSIZE_T_CLEAN */")
-        self._put_setup_code(code, "InitLimitedAPI")
-
-        for inc in sorted(env.c_includes.values(), key=IncludeCode.sortkey):
-            if inc.location == inc.INITIAL:
-                inc.write(code)
-        code.putln("#ifndef Py_PYTHON_H")
-        code.putln("    #error Python headers needed to compile C extensions, "
-                   "please install development version of Python.")
-        code.putln("#elif PY_VERSION_HEX < 0x03090000")
-        code.putln("    #error Cython requires Python 3.9+.")
-        code.putln("#elif defined(Py_LIMITED_API) && (Py_LIMITED_API & 0xFFFF0000) > (PY_VERSION_HEX & 0xFFFF0000)")
-        code.putln("    #error 'Py_LIMITED_API' can only select past Python X.Y versions, not future ones.")
-        code.putln("#else")
-        code.globalstate["end"].putln("#endif /* Py_PYTHON_H */")
+        initial_includes = [
+            inc for inc in sorted(env.c_includes.values(), key=IncludeCode.sortkey)
+            if inc.location == inc.INITIAL]
+
+        # The start of the preamble does not depend on the module, unless user code gets
+        # included before "Python.h".  With a common utility include directory, we write it
+        # into a shared header that C compilers can precompile once for all modules.
+        preamble = code
+        if options.common_utility_include_dir and [inc.pieces for inc in initial_includes] == [{0: '#include "Python.h"'}]:
+            preamble = code.create_new(create_from=code, buffer=None, copy_formatting=False)
+
+        preamble.putln("#ifndef PY_SSIZE_T_CLEAN")
+        preamble.putln("#define PY_SSIZE_T_CLEAN")
+        preamble.putln("#endif /* PY_SSIZE_T_CLEAN */")
+        self._put_setup_code(preamble, "InitLimitedAPI")
+
+        for inc in initial_includes:
+            inc.write(preamble)
+        preamble.putln("#ifndef Py_PYTHON_H")
+        preamble.putln("    #error Python headers needed to compile C extensions, "
+                       "please install development version of Python.")
+        preamble.putln("#elif PY_VERSION_HEX < 0x03090000")
+        preamble.putln("    #error Cython requires Python 3.9+.")
+        preamble.putln("#elif defined(Py_LIMITED_API) && (Py_LIMITED_API & 0xFFFF0000) > (PY_VERSION_HEX & 0xFFFF0000)")
+        preamble.putln("    #error 'Py_LIMITED_API' can only select past Python X.Y versions, not future ones.")
+        preamble.putln("#else")
 
         from .. import __version__
-        code.putln(f'#define __PYX_ABI_VERSION "{__version__.replace(".", "_")}"')
-        code.putln('#define CYTHON_HEX_VERSION %s' % build_hex_version(__version__))
+        preamble.putln(f'#define __PYX_ABI_VERSION "{__version__.replace(".", "_")}"')
+        preamble.putln('#define CYTHON_HEX_VERSION %s' % build_hex_version(__version__))
+        if code.globalstate.split_output:
+            preamble.putln("#define __PYX_SPLIT_OUTPUT 1")
+
+        self._put_setup_code(preamble, "CModulePreamble")
+        if env.context.options.cplus:
+            self._put_setup_code(preamble, "CppInitCode")
+        else:
+            self._put_setup_code(preamble, "CInitCode")
+        self._put_setup_code(preamble, "PythonCompatibility")
+        self._put_setup_code(preamble, "MathInitCode")
+
+        if preamble is code:
+            code.globalstate["end"].putln("#endif /* Py_PYTHON_H */")
+        else:
+            preamble.putln("#endif /* Py_PYTHON_H */")
+            # Utility code headers in the same directory get included relative to the shared header.
+            include_dir_prefix = os.path.join(options.common_utility_include_dir, '').replace('\\', '/')
+            preamble_code = preamble.getvalue().replace(f'#include "{include_dir_prefix}', '#include "')
+            c_path = Code.write_common_include_file(
+                options.common_utility_include_dir, preamble_code, "ModulePreamble")
+            code.putln(f'#include "{c_path}"')
+            # The shared header only defines CYTHON_HEX_VERSION if its checks passed.
+            code.putln("#ifdef CYTHON_HEX_VERSION")
+            code.globalstate["end"].putln("#endif /* CYTHON_HEX_VERSION */")
+
         code.putln("#define CYTHON_FUTURE_DIVISION %d" % (
             Future.division in env.context.future_directives))
 
         code.globalstate.use_utility_code(
             UtilityCode.load("CythonABIVersion", "ModuleSetupCode.c"))
 
-        self._put_setup_code(code, "CModulePreamble")
-        if env.context.options.cplus:
-            self._put_setup_code(code, "CppInitCode")
-        else:
-            self._put_setup_code(code, "CInitCode")
-        self._put_setup_code(code, "PythonCompatibility")
-        self._put_setup_code(code, "MathInitCode")
-
         # Error handling and position macros.
         # Using "(void)cname" to prevent "unused" warnings.
         mark_errpos_code = (
@@ -1032,9 +1086,9 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
         self._put_setup_code(code, "PretendToInitialize")
         code.putln('')
         code.putln('#if !CYTHON_USE_MODULE_STATE')
-        code.putln('static PyObject *%s = NULL;' % env.module_cname)
+        code.put_module_variable('PyObject *%s' % env.module_cname, 'NULL')
         if Options.pre_import is not None:
-            code.putln('static PyObject *%s;' % Naming.preimport_cname)
+            code.put_module_variable('PyObject *%s' % Naming.preimport_cname)
         code.putln('#endif')
 
         code.putln('static const char * const %s = %s;' % (Naming.cfilenm_cname, Naming.file_c_macro))
@@ -1416,7 +1470,7 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
         # Generate declaration of pointer to an extension type's vtable.
         type = entry.type
         if type.vtabptr_cname:
-            code.putln("static struct %s *%s;" % (
+            code.put_module_variable("struct %s *%s" % (
                 type.vtabstruct_cname,
                 type.vtabptr_cname))
 
@@ -1431,7 +1485,7 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
                 declaration = method_entry.type.declaration_code(
                     method_entry.final_func_cname)
                 modifiers = code.build_function_modifiers(method_entry.func_modifiers)
-                code.putln("static %s%s;" % (modifiers, declaration))
+                code.putln("%s %s%s;" % (code.globalstate.module_linkage(), modifiers, declaration))
 
     def generate_objstruct_predeclaration(self, type, code):
         if not type.scope:
@@ -1541,17 +1595,21 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
                 cname = env.mangle(Naming.varptr_prefix, entry.name)
                 init = 0
 
-            if storage_class:
-                code.put("%s " % storage_class)
             if entry.is_cpp_optional:
-                code.put(type.cpp_optional_declaration_code(
-                    cname, dll_linkage=dll_linkage))
+                declaration = type.cpp_optional_declaration_code(
+                    cname, dll_linkage=dll_linkage)
             else:
-                code.put(type.declaration_code(
-                    cname, dll_linkage=dll_linkage))
-            if init is not None:
-                code.put_safe(" = %s" % init)
-            code.putln(";")
+                declaration = type.declaration_code(
+                    cname, dll_linkage=dll_linkage)
+            if storage_class == "static":
+                code.put_module_variable(declaration, init)
+            else:
+                if storage_class:
+                    code.put("%s " % storage_class)
+                code.put(declaration)
+                if init is not None:
+                    code.put_safe(" = %s" % init)
+                code.putln(";")
             if entry.cname != cname:
                 code.putln("#define %s (*%s)" % (entry.cname, cname))
             code.globalstate.use_entry_utility_code(entry)
@@ -3269,9 +3327,17 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
 
     def generate_module_state_start(self, env, code):
         # TODO: Refactor to move module state struct decl closer to the static decl
-        code.putln("#ifdef __cplusplus")
-        code.putln("namespace {")
-        code.putln("#endif")
+        if code.globalstate.split_output:
+            # The C files of a split module share the module state, which does not work
+            # with a separate state per module object, nor with a type that is local to
+            # each C++ file.
+            code.putln("#if CYTHON_USE_MODULE_STATE")
+            code.putln('#error "Modules that are split into several C files do not support CYTHON_USE_MODULE_STATE."')
+            code.putln("#endif")
+        else:
+            code.putln("#ifdef __cplusplus")
+            code.putln("namespace {")
+            code.putln("#endif")
         code.putln('typedef struct {')
         code.putln('PyObject *%s;' % env.module_dict_cname)
         code.putln('PyObject *%s;' % Naming.builtins_cname)
@@ -3287,9 +3353,10 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
         module_state_clear = globalstate['module_state_clear_end']
         module_state_traverse = globalstate['module_state_traverse_end']
         module_state.putln('} %s;' % Naming.modulestatetype_cname)
-        module_state.putln("#ifdef __cplusplus")
-        module_state.putln("} /* anonymous namespace */")
-        module_state.putln("#endif")
+        if not globalstate.split_output:
+            module_state.putln("#ifdef __cplusplus")
+            module_state.putln("} /* anonymous namespace */")
+            module_state.putln("#endif")
         module_state.putln('')
         globalstate.use_utility_code(
             UtilityCode.load("MultiPhaseInitModuleState", "ModuleSetupCode.c")
@@ -3311,7 +3378,16 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
             env.module_cname,
             Naming.pymoduledef_cname))
         module_state.putln("#else")
-        module_state.putln('static %s %s_static =' % (
+        if globalstate.split_output:
+            module_state.putln('#ifdef __PYX_SPLIT_PART')
+            module_state.putln('extern %s %s %s_static;' % (
+                globalstate.module_linkage(),
+                Naming.modulestatetype_cname,
+                Naming.modulestateglobal_cname
+            ))
+            module_state.putln('#else')
+        module_state.putln('%s %s %s_static =' % (
+            globalstate.module_linkage(),
             Naming.modulestatetype_cname,
             Naming.modulestateglobal_cname
         ))
@@ -3322,6 +3398,8 @@ class ModuleNode(Nodes.Node, Nodes.BlockNode):
         module_state.putln('#else')
         module_state.putln('    {0};')
         module_state.putln('#endif')
+        if globalstate.split_output:
+            module_state.putln('#endif')
         module_state.putln('static %s * const %s = &%s_static;' % (
             Naming.modulestatetype_cname,
             Naming.modulestateglobal_cname,
@@ -4509,26 +4587,22 @@ def generate_cfunction_declaration(entry, env, code, definition):
         elif entry.visibility == 'public':
             storage_class = Naming.extern_c_macro
             dll_linkage = None
-        elif entry.visibility == 'private':
-            storage_class = "static"
-            dll_linkage = None
         else:
-            storage_class = "static"
+            storage_class = code.globalstate.module_linkage()
             dll_linkage = None
         type = entry.type
 
         if entry.defined_in_pxd and not definition:
-            storage_class = "static"
-            dll_linkage = None
-            type = CPtrType(type)
-
-        header = type.declaration_code(
-            entry.cname, dll_linkage=dll_linkage)
-        modifiers = code.build_function_modifiers(entry.func_modifiers)
-        code.putln("%s %s%s; /*proto*/" % (
-            storage_class,
-            modifiers,
-            header))
+            # function pointer that the module init function imports
+            code.put_module_variable(CPtrType(type).declaration_code(entry.cname))
+        else:
+            header = type.declaration_code(
+                entry.cname, dll_linkage=dll_linkage)
+            modifiers = code.build_function_modifiers(entry.func_modifiers)
+            code.putln("%s %s%s; /*proto*/" % (
+                storage_class,
+                modifiers,
+                header))
         code.globalstate.use_entry_utility_code(entry)
 
 #------------------------------------------------------------------------------------
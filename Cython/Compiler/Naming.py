@@ -87,6 +87,7 @@ callargs_cname   = pyrex_prefix + "callargs"
 generator_cname  = pyrex_prefix + "generator"
 sent_value_cname = pyrex_prefix + "sent_value"
 pykwdlist_cname  = pyrex_prefix + "pyargnames"
+pykwdhash_cname  = pyrex_prefix + "pyargnames_hash"
 obj_base_cname   = pyrex_prefix + "base"
 builtins_cname   = pyrex_prefix + "b"
 preimport_cname  = pyrex_prefix + "i"
@@ -151,6 +152,8 @@ quick_temp_cname = pyrex_prefix + "temp"  # temp variable for quick'n'dirty temp
 tp_dict_version_temp = pyrex_prefix + "tp_dict_version"
 obj_dict_version_temp = pyrex_prefix + "obj_dict_version"
 type_dict_guard_temp = pyrex_prefix + "typedict_guard"
+tp_version_tags_temp = pyrex_prefix + "tp_version_tags"
+tp_version_guard_temp = pyrex_prefix + "tp_version_guard"
 cython_runtime_cname   = pyrex_prefix + "cython_runtime"
 # the name "dflt" was picked by analogy with the CPython dataclass module which stores
 # the default values in variables named f"_dflt_{field.name}" in a hidden scope that's
@@ -184,6 +187,12 @@ parallel_lineno = pyrex_prefix + "parallel_lineno"
 parallel_clineno = pyrex_prefix + "parallel_clineno"
 parallel_why = pyrex_prefix + "parallel_why"
 parallel_loop_threadstate = pyrex_prefix + "parallel_loop_threadstate"
+parallel_ctx = pyrex_prefix + "parallel_ctx"
+parallel_team = pyrex_prefix + "parallel_team"
+parallel_thread_num = pyrex_prefix + "parallel_thread_num"
+parallel_chunk_begin = pyrex_prefix + "parallel_begin"
+parallel_chunk_end = pyrex_prefix + "parallel_end"
+parallel_firstprivate_prefix = pyrex_prefix + "firstprivate_"
 
 # Python itself used _Py_cs so loosely follow that convention
 critical_section_variable = pyrex_prefix + "cs"
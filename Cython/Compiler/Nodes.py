@@ -874,6 +874,10 @@ class CFuncDeclaratorNode(CDeclaratorNode):
             else:
                 self.declare_optional_arg_struct(func_type, env)
 
+        fused_specializations = env.directives.get('fused_specializations')
+        if fused_specializations and func_type.is_fused:
+            func_type.fused_specializations = fused_specializations
+
         callspec = env.directives['callspec']
         if callspec:
             current = func_type.calling_convention
@@ -2083,6 +2087,7 @@ class FuncDefNode(StatNode, BlockNode):
     def generate_function_definitions(self, env, code):
         from . import Buffer
 
+        code = code.globalstate.split_function_writer(code)
         lenv = self.local_scope
         if lenv.is_closure_scope and not lenv.is_passthrough:
             outer_scope_cname = "%s->%s" % (Naming.cur_scope_cname,
@@ -2130,6 +2135,7 @@ class FuncDefNode(StatNode, BlockNode):
 
         if preprocessor_guard:
             code.putln(preprocessor_guard)
+        code.funcstate.outlined_code_writer = code.insertion_point()
 
         with_pymethdef = (self.needs_assignment_synthesis(env, code) or
                           self.pymethdef_required)
@@ -3017,7 +3023,7 @@ class CFuncDefNode(FuncDefNode):
             cname = self.entry.func_cname
         entity = type.function_header_code(cname, ', '.join(arg_decls))
         if self.entry.visibility == 'private' and '::' not in cname:
-            storage_class = "static "
+            storage_class = code.globalstate.module_linkage() + " "
         else:
             storage_class = ""
         dll_linkage = None
@@ -3686,6 +3692,7 @@ class DefNode(FuncDefNode):
         return self.entry.signature.exception_check
 
     def generate_function_definitions(self, env, code):
+        code = code.globalstate.split_function_writer(code)
         if self.defaults_getter:
             # defaults getter must never live in class scopes, it's always a module function
             module_scope = env.global_scope()
@@ -3739,11 +3746,12 @@ class DefNode(FuncDefNode):
         preprocessor_guard = self.get_preprocessor_guard()
         if preprocessor_guard:
             decls_code.putln(preprocessor_guard)
+        linkage = code.globalstate.module_linkage()
         decls_code.putln(
-            "static %s(%s); /* proto */" % (dc, arg_code))
+            "%s %s(%s); /* proto */" % (linkage, dc, arg_code))
         if preprocessor_guard:
             decls_code.putln("#endif")
-        code.putln("static %s(%s) {" % (dc, arg_code))
+        code.putln("%s %s(%s) {" % (linkage, dc, arg_code))
 
     def generate_argument_declarations(self, env, code):
         pass
@@ -3786,12 +3794,94 @@ class DefNode(FuncDefNode):
         pass
 
 
+# Functions with fewer keyword argument names search them linearly.
+MIN_KEYWORD_HASH_TABLE_NAMES = 8
+
+
+def _keyword_hash(name, positions):
+    # Must stay in sync with __Pyx_MatchKeywordArgHashed() in FunctionArguments.c.
+    length = len(name)
+    h = 0x811c9dc5
+    for position in positions:
+        h = ((h ^ (ord(name[position]) if position < length else 0)) * 0x01000193) & 0xffffffff
+    return ((h ^ length) * 0x01000193) & 0xffffffff
+
+
+def _keyword_hash_slot(h, displacement):
+    h = ((h ^ displacement) * 0x01000193) & 0xffffffff
+    return h ^ (h >> 15)
+
+
+def build_keyword_hash_table(names):
+    """
+    Build a perfect hash table for the keyword argument names of a function.
+    The hash combines the length of a name with its characters at the positions
+    that are needed to tell the names apart.  It selects a bucket, whose
+    displacement value is mixed into the hash to find the slot of the name
+    ("hash and displace"), so that the table stays close to the number of names.
+
+    Returns a tuple (positions, displacements, slots), where slots maps each
+    slot to the index of the name plus one (0 for unused slots), or None.
+    """
+    if len(names) > 255:
+        return None
+    max_length = min(max(len(name) for name in names), 256)
+
+    def num_distinct_keys(positions):
+        return len({
+            (len(name),) + tuple([name[position] if position < len(name) else '' for position in positions])
+            for name in names
+        })
+
+    positions = []
+    num_distinct = num_distinct_keys(positions)
+    while num_distinct < len(names):
+        best_position = max(range(max_length), key=lambda position: num_distinct_keys(positions + [position]))
+        best_num_distinct = num_distinct_keys(positions + [best_position])
+        if best_num_distinct == num_distinct:
+            return None  # duplicate names
+        positions.append(best_position)
+        num_distinct = best_num_distinct
+
+    hashes = [_keyword_hash(name, positions) for name in names]
+    if len(set(hashes)) < len(names):
+        return None
+
+    table_size = 1
+    while table_size < len(names):
+        table_size *= 2
+    for _ in range(3):
+        buckets = [[] for _ in range(table_size)]
+        for index, h in enumerate(hashes):
+            buckets[(h ^ (h >> 15)) & (table_size - 1)].append(index)
+        displacements = [0] * table_size
+        slots = [0] * table_size
+        for bucket_index in sorted(range(table_size), key=lambda i: -len(buckets[i])):
+            bucket = buckets[bucket_index]
+            if not bucket:
+                continue
+            for displacement in range(256):
+                bucket_slots = {_keyword_hash_slot(hashes[index], displacement) & (table_size - 1) for index in bucket}
+                if len(bucket_slots) == len(bucket) and not any(slots[slot] for slot in bucket_slots):
+                    break
+            else:
+                break  # retry with a larger table
+            displacements[bucket_index] = displacement
+            for index in bucket:
+                slots[_keyword_hash_slot(hashes[index], displacement) & (table_size - 1)] = index + 1
+        else:
+            return positions, displacements, slots
+        table_size *= 2
+    return None
+
+
 class DefNodeWrapper(FuncDefNode):
     # DefNode python wrapper code generator
 
     defnode = None
     target = None  # Target DefNode
     needs_values_cleanup = False
+    has_keyword_hash_table = False
 
     def __init__(self, *args, **kwargs):
         FuncDefNode.__init__(self, *args, **kwargs)
@@ -4011,8 +4101,11 @@ class DefNodeWrapper(FuncDefNode):
             with_pymethdef = False
 
         dc = self.return_type.declaration_code(entry.func_cname)
-        header = "%sstatic %s(%s)" % (mf, dc, arg_code)
+        header = "%s%s %s(%s)" % (mf, code.globalstate.module_linkage(), dc, arg_code)
         code.putln("%s; /*proto*/" % header)
+        if code.globalstate.split_output and not proto_only:
+            # The method tables of a split module may live in a different C file.
+            code.globalstate['decls'].putln("%s; /*proto*/" % header)
 
         if proto_only:
             if self.target.fused_py_func:
@@ -4033,20 +4126,36 @@ class DefNodeWrapper(FuncDefNode):
             if docstr.is_unicode:
                 docstr = docstr.as_utf8_string()
 
+            # The method tables and the module init function of a split module
+            # may live in a different C file than the function.
+            split_output = code.globalstate.split_output
+            doc_code = code.globalstate['decls'] if split_output else code
             if not (entry.is_special and entry.name in ('__getbuffer__', '__releasebuffer__')):
-                code.putln('PyDoc_STRVAR(%s, %s);' % (
-                    entry.doc_cname,
-                    docstr.as_c_string_literal()))
+                if split_output:
+                    doc_code.put_module_variable(
+                        "const char %s[]" % entry.doc_cname,
+                        "PyDoc_STR(%s)" % docstr.as_c_string_literal())
+                else:
+                    doc_code.putln('PyDoc_STRVAR(%s, %s);' % (
+                        entry.doc_cname,
+                        docstr.as_c_string_literal()))
 
             if entry.is_special:
-                code.putln('#if CYTHON_UPDATE_DESCRIPTOR_DOC')
-                code.putln(
-                    "struct wrapperbase %s;" % entry.wrapperbase_cname)
-                code.putln('#endif')
+                doc_code.putln('#if CYTHON_UPDATE_DESCRIPTOR_DOC')
+                if split_output:
+                    doc_code.put_module_variable("struct wrapperbase %s" % entry.wrapperbase_cname)
+                else:
+                    doc_code.putln(
+                        "struct wrapperbase %s;" % entry.wrapperbase_cname)
+                doc_code.putln('#endif')
 
         if with_pymethdef or self.target.fused_py_func:
+            linkage = code.globalstate.module_linkage()
+            if code.globalstate.split_output:
+                code.globalstate['decls'].putln(
+                    "extern %s PyMethodDef %s; /* proto */" % (linkage, entry.pymethdef_cname))
             code.put(
-                "static PyMethodDef %s = " % entry.pymethdef_cname)
+                "%s PyMethodDef %s = " % (linkage, entry.pymethdef_cname))
             code.put_pymethoddef(self.target.entry, ";", allow_skip=False)
         code.putln("%s {" % header)
 
@@ -4319,6 +4428,7 @@ class DefNodeWrapper(FuncDefNode):
             code.putln("PyObject ** const %s[] = {%s};" % (
                 Naming.pykwdlist_cname,
                 non_pos_args_id))
+            self.generate_keyword_hash_table(non_posonly_args, code)
 
         # Before being converted and assigned to the target variables,
         # borrowed references to all unpacked argument values are
@@ -4497,6 +4607,23 @@ class DefNodeWrapper(FuncDefNode):
             ))
             code.put_label(skip_error_handling)
 
+    def generate_keyword_hash_table(self, non_posonly_args, code):
+        if len(non_posonly_args) < MIN_KEYWORD_HASH_TABLE_NAMES:
+            return
+        hash_table = build_keyword_hash_table([arg.entry.name for arg in non_posonly_args])
+        if hash_table is None:
+            return
+        positions, displacements, slots = hash_table
+        code.globalstate.use_utility_code(
+            UtilityCode.load_cached("KeywordHashTable", "FunctionArguments.c"))
+        for field, values in [('positions', positions or [0]), ('displacements', displacements), ('slots', slots)]:
+            code.putln("static const unsigned char %s_%s[] = {%s};" % (
+                Naming.pykwdhash_cname, field, ','.join(map(str, values))))
+        code.putln("static const __Pyx_KeywordHashTable %s = {%s_positions, %s_displacements, %s_slots, %d, %#xU};" % (
+            Naming.pykwdhash_cname, Naming.pykwdhash_cname, Naming.pykwdhash_cname, Naming.pykwdhash_cname,
+            len(positions), len(slots) - 1))
+        self.has_keyword_hash_table = True
+
     def generate_arg_assignment(self, arg, item, code):
         if arg.type.is_pyobject:
             # Python default arguments were already stored in 'item' at the very beginning
@@ -4680,6 +4807,7 @@ class DefNodeWrapper(FuncDefNode):
             self.pos,
             f"__Pyx_ParseKeywords("
             f"{Naming.kwds_cname}, {Naming.kwvalues_cname}, {Naming.pykwdlist_cname}, "
+            f"{'&' + Naming.pykwdhash_cname if self.has_keyword_hash_table else '0'}, "
             f"{self.starstar_arg.entry.cname if self.starstar_arg else '0'}, "
             f"{values_array}, "
             f"{pos_arg_count}, "
@@ -4826,6 +4954,7 @@ class GeneratorDefNode(DefNode):
         code.putln('}')
 
     def generate_function_definitions(self, env, code):
+        code = code.globalstate.split_function_writer(code)
         env.use_utility_code(UtilityCode.load_cached(self.gen_type_name, "Coroutine.c"))
         self.gbody.generate_function_header(code, proto=True)
         super().generate_function_definitions(env, code)
@@ -4883,7 +5012,8 @@ class GeneratorBodyDefNode(DefNode):
         self.declare_generator_body(env)
 
     def generate_function_header(self, code, proto=False):
-        header = "static PyObject *%s(__pyx_CoroutineObject *%s, CYTHON_UNUSED PyThreadState *%s, PyObject *%s)" % (
+        header = "%s PyObject *%s(__pyx_CoroutineObject *%s, CYTHON_UNUSED PyThreadState *%s, PyObject *%s)" % (
+            code.globalstate.module_linkage(),
             self.entry.func_cname,
             Naming.generator_cname,
             Naming.local_tstate_cname,
@@ -5103,7 +5233,10 @@ class OverrideCheckNode(StatNode):
         code.putln("/* Check if called by wrapper */")
         code.putln("if (unlikely(%s)) ;" % Naming.skip_dispatch_cname)
         code.putln("/* Check if overridden in Python */")
-        if self.py_func.is_module_scope or self.py_func.entry.scope.lookup_here("__dict__"):
+        # Types without instance dicts cannot override the method per instance,
+        # so the result of the lookup stays valid as long as the type is unchanged.
+        use_type_version = not (self.py_func.is_module_scope or self.py_func.entry.scope.lookup_here("__dict__"))
+        if not use_type_version:
             code.putln("else {")
         else:
             code.putln("else if (")
@@ -5122,6 +5255,17 @@ class OverrideCheckNode(StatNode):
             code.putln("#endif")
             code.putln(") {")
 
+        if use_type_version:
+            code.globalstate.use_utility_code(
+                UtilityCode.load_cached("TypeVersionOverrideGuard", "ObjectHandling.c"))
+            code.putln("#if CYTHON_USE_TYPE_VERSION_CACHE")
+            code.putln("static unsigned int %s[__PYX_TP_VERSION_CACHE_SIZE] = {0};" % Naming.tp_version_tags_temp)
+            code.putln("if (unlikely(!__Pyx_tp_version_tag_matches(%s, %s))) {" % (
+                self_arg, Naming.tp_version_tags_temp))
+            code.putln("unsigned int %s = __Pyx_get_cacheable_tp_version_tag(%s);" % (
+                Naming.tp_version_guard_temp, self_arg))
+            code.putln("#endif")
+
         code.putln("#if CYTHON_USE_DICT_VERSIONS && CYTHON_USE_PYTYPE_LOOKUP && CYTHON_USE_TYPE_SLOTS")
         code.globalstate.use_utility_code(
             UtilityCode.load_cached("PyDictVersioning", "ObjectHandling.c"))
@@ -5131,7 +5275,13 @@ class OverrideCheckNode(StatNode):
         # instance at a time.
         code.putln("static PY_UINT64_T %s = __PYX_DICT_VERSION_INIT, %s = __PYX_DICT_VERSION_INIT;" % (
             Naming.tp_dict_version_temp, Naming.obj_dict_version_temp))
-        code.putln("if (unlikely(!__Pyx_object_dict_version_matches(%s, %s, %s))) {" % (
+        code.putln("if (")
+        if use_type_version:
+            # The type version also covers changes in base classes, which the dict versions miss.
+            code.putln("#if CYTHON_USE_TYPE_VERSION_CACHE")
+            code.putln("%s ||" % Naming.tp_version_guard_temp)
+            code.putln("#endif")
+        code.putln("unlikely(!__Pyx_object_dict_version_matches(%s, %s, %s))) {" % (
             self_arg, Naming.tp_dict_version_temp, Naming.obj_dict_version_temp))
         code.putln("PY_UINT64_T %s = __Pyx_get_tp_dict_version(%s);" % (
             Naming.type_dict_guard_temp, self_arg))
@@ -5151,6 +5301,16 @@ class OverrideCheckNode(StatNode):
         self.body.generate_execution_code(code)
         code.putln("}")
 
+        if use_type_version:
+            # Only remember the type if it did not change during the lookup.
+            code.putln("#if CYTHON_USE_TYPE_VERSION_CACHE")
+            code.putln("if (likely(%s == __Pyx_get_cacheable_tp_version_tag(%s))) {" % (
+                Naming.tp_version_guard_temp, self_arg))
+            code.putln("__Pyx_tp_version_tag_slot(%s, %s) = %s;" % (
+                Naming.tp_version_tags_temp, Naming.tp_version_guard_temp, Naming.tp_version_guard_temp))
+            code.putln("}")
+            code.putln("#endif")
+
         # NOTE: it's not 100% sure that we catch the exact versions here that were used for the lookup,
         # but it is very unlikely that the versions change during lookup, and the type dict safe guard
         # should increase the chance of detecting such a case.
@@ -5177,6 +5337,10 @@ class OverrideCheckNode(StatNode):
         code.putln("#if CYTHON_USE_DICT_VERSIONS && CYTHON_USE_PYTYPE_LOOKUP && CYTHON_USE_TYPE_SLOTS")
         code.putln("}")
         code.putln("#endif")
+        if use_type_version:
+            code.putln("#if CYTHON_USE_TYPE_VERSION_CACHE")
+            code.putln("}")
+            code.putln("#endif")
 
         code.putln("}")
 
@@ -7950,12 +8114,23 @@ class ForFromStatNode(LoopNode, StatNode):
     #  is_py_target       bool
     #  loopvar_node       ExprNode (usually a NameNode or temp node)
     #  py_loopvar_node    PyTempNode or None
+    #  index_guard_lower  bool     memoryview index guard checks the lower bound against 0
+    #  index_guard_shapes [(NameNode, int)]  memoryview dimensions that the index guard checks
+    #                                        the upper bound against
+    #  index_guard_bounds_fit  bool  memoryview index guard checks that the loop variable type can hold the bounds
+    #  index_guard_cname  string   C flag that is true if the loop variable stays within the guarded bounds
+    #  hoisted_accesses   [MemoryView.HoistedSliceAccess]  memoryview addressing to calculate before the loop
     child_attrs = ["target", "bound1", "bound2", "step", "body", "else_clause"]
 
     is_py_target = False
     loopvar_node = None
     py_loopvar_node = None
     from_range = False
+    index_guard_lower = False
+    index_guard_shapes = ()
+    index_guard_bounds_fit = False
+    index_guard_cname = None
+    hoisted_accesses = ()
 
     gil_message = "For-loop using object bounds or target"
 
@@ -8029,6 +8204,53 @@ class ForFromStatNode(LoopNode, StatNode):
             self.loopvar_node = c_loopvar_node
             self.py_loopvar_node = ExprNodes.CloneNode(c_loopvar_node).coerce_to_pyobject(env)
 
+    def range_bounds(self):
+        """
+        Returns the lower and upper bound of the loop variable inside of the loop body
+        as pairs (bound node, is_exclusive), e.g. ((bound1, False), (bound2, True))
+        for "bound1 <= i < bound2".
+        """
+        if self.relation1 in ('<', '<='):
+            return (self.bound1, self.relation1 == '<'), (self.bound2, self.relation2 == '<')
+        else:
+            return (self.bound2, self.relation2 == '>'), (self.bound1, self.relation1 == '>')
+
+    def narrowed_range_bounds(self):
+        """
+        Returns the range bounds that a signed loop variable might not be able to hold
+        because their type is wider.  The loop truncates them when it assigns them to
+        the loop variable, or the loop variable overflows before it reaches them.
+        Small constants fit into any signed type.
+        """
+        target_type = self.target.type
+        if not target_type.signed:
+            return []
+        return [
+            bound for (bound, _) in self.range_bounds()
+            if not (isinstance(bound.constant_result, int) and -128 <= bound.constant_result <= 127)
+            and PyrexTypes.widest_numeric_type(target_type, bound.type) is not target_type]
+
+    def generate_index_guard_code(self, code):
+        (lower, lower_exclusive), (upper, upper_exclusive) = self.range_bounds()
+        conditions = []
+        narrowed_bounds = self.narrowed_range_bounds() if self.index_guard_bounds_fit else []
+        target_type_code = self.target.type.empty_declaration_code()
+        for bound in narrowed_bounds:
+            conditions.append("(%s == (%s)%s)" % (bound.result(), target_type_code, bound.result()))
+        if self.index_guard_lower:
+            lower_code = lower.result()
+            if any(bound is lower for bound in narrowed_bounds):
+                # An unsigned lower bound can compare equal to its negative truncation.
+                lower_code = "((%s)%s)" % (target_type_code, lower_code)
+            conditions.append("(%s >= %d)" % (lower_code, -1 if lower_exclusive else 0))
+        cast = "" if self.target.type.signed else "(size_t)"
+        for base, dim in self.index_guard_shapes:
+            shape = base.type.get_entry(base).get_buf_shapevars()[dim]
+            conditions.append("(%s %s %s%s)" % (
+                upper.result(), "<=" if upper_exclusive else "<", cast, shape))
+        self.index_guard_cname = code.funcstate.allocate_temp(PyrexTypes.c_bint_type, manage_ref=False)
+        code.putln("%s = %s;" % (self.index_guard_cname, " && ".join(conditions)))
+
     def generate_execution_code(self, code):
         code.mark_pos(self.pos)
         old_loop_labels = code.new_loop_labels()
@@ -8042,6 +8264,10 @@ class ForFromStatNode(LoopNode, StatNode):
             incop = "%s=%s" % (incop[0], step)  # e.g. '++' => '+= STEP'
         else:
             step = '1'
+        if self.index_guard_lower or self.index_guard_shapes or self.index_guard_bounds_fit:
+            self.generate_index_guard_code(code)
+        for hoisted_access in self.hoisted_accesses:
+            hoisted_access.generate_hoisting_code(code)
 
         from . import ExprNodes
         if isinstance(self.loopvar_node, ExprNodes.TempNode):
@@ -8123,6 +8349,11 @@ class ForFromStatNode(LoopNode, StatNode):
             self.target.generate_assignment_code(self.py_loopvar_node, code)
         if from_range and not self.is_py_target:
             code.funcstate.release_temp(loopvar_name)
+        if self.index_guard_cname:
+            code.funcstate.release_temp(self.index_guard_cname)
+            self.index_guard_cname = None
+        for hoisted_access in self.hoisted_accesses:
+            hoisted_access.release(code)
 
         break_label = code.break_label
         code.set_loop_labels(old_loop_labels)
@@ -10030,6 +10261,17 @@ class ParallelStatNode(StatNode, ParallelNode):
     args         tuple          the arguments passed to the parallel construct
     kwargs       DictNode       the keyword arguments passed to the parallel
                                 construct (replaced by its compile time value)
+
+    python_privates     [(entry, original cname, temp)] Python object variables
+                        that each thread of a section with the GIL assigns to
+                        in its own reference
+    element_reductions  [ParallelElementReduction] memoryviews, C arrays and
+                        structs that a prange() with 'element_reduction'
+                        reduces item by item
+    has_return          whether a return statement leaves this section
+    has_nested_section  whether this section contains another parallel section
+    threads_backend     whether this section runs in Cython's thread pool
+                        instead of OpenMP (directive parallel_backend="threads")
     """
 
     child_attrs = ['body', 'num_threads', 'threading_condition']
@@ -10040,11 +10282,22 @@ class ParallelStatNode(StatNode, ParallelNode):
     is_nested_prange = False
 
     error_label_used = False
+    has_return = False
+    has_nested_section = False
+    threads_backend = False
+    python_privates = ()
+    element_reductions = ()
 
     num_threads = None
+    num_threads_result = None
     chunksize = None
     threading_condition = None
 
+    # The thread pool backend replaces these with the variables of the calling
+    # function, which it reaches through its context struct.
+    parallel_why = Naming.parallel_why
+    parallel_freethreading_mutex = Naming.parallel_freethreading_mutex
+
     parallel_exc = (
         Naming.parallel_exc_type,
         Naming.parallel_exc_value,
@@ -10289,12 +10542,20 @@ class ParallelStatNode(StatNode, ParallelNode):
 
         return expr.result()
 
+    def evaluate_num_threads(self, code):
+        """
+        Evaluate self.num_threads before the block, unless it already was.
+        """
+        if self.num_threads_result is None:
+            self.num_threads_result = self.evaluate_before_block(code, self.num_threads)
+        return self.num_threads_result
+
     def put_num_threads(self, code):
         """
         Write self.num_threads if set as the num_threads OpenMP directive
         """
         if self.num_threads is not None:
-            num_threads_result = self.evaluate_before_block(code, self.num_threads)
+            num_threads_result = self.evaluate_num_threads(code)
             if not self.num_threads.is_literal:
                 num_threads_result = f"{num_threads_result} != 0 ? {num_threads_result} : omp_get_max_threads()"
             code.put(f" num_threads({num_threads_result})")
@@ -10363,8 +10624,42 @@ class ParallelStatNode(StatNode, ParallelNode):
         # Now clean up any memoryview slice and object temporaries
         if self.is_parallel and not self.is_nested_prange:
             code.putln("/* Clean up any temporaries */")
+            # Temps without a reference of their own (e.g. borrowed memoryview slices) are skipped.
+            managed_temps = set(code.funcstate.all_managed_temps())
             for temp, type in sorted(self.temps):
-                code.put_xdecref_clear(temp, type, have_gil=True)
+                if (temp, type) in managed_temps:
+                    code.put_xdecref_clear(temp, type, have_gil=True)
+
+    def python_private_entries(self):
+        """
+        Python object variables that this section assigns to while holding the
+        GIL, which only makes sense on freethreaded Python. OpenMP cannot make
+        them private, as it does not know about reference counts, so the
+        threads would share (and corrupt) them otherwise.
+        """
+        if not (self.acquire_gil and self.is_parallel):
+            return []
+        return [entry for entry, op in sorted(self.privates.items())
+                if entry.type.is_pyobject and not (self.is_prange and op and op in "+*-&^|")]
+
+    def privatize_python_objects(self, code):
+        """
+        Replace the Python object privates by temps while generating the body.
+        As they are allocated after code.funcstate.start_collecting_temps(),
+        privatize_temps() makes them private and cleanup_temps() releases the
+        reference of each thread. end_parallel_block() initialises them with
+        a new reference to the value of the variable.
+        """
+        self.python_privates = []
+        for entry in self.python_private_entries():
+            temp = code.funcstate.allocate_temp(entry.type, manage_ref=True)
+            self.python_privates.append((entry, entry.cname, temp))
+            entry.cname = temp
+
+    def release_python_privates(self, code):
+        for entry, original_cname, temp in self.python_privates:
+            entry.cname = original_cname
+            code.funcstate.release_temp(temp)
 
     def setup_parallel_control_flow_block(self, code):
         """
@@ -10427,18 +10722,27 @@ class ParallelStatNode(StatNode, ParallelNode):
         begin_code = self.begin_of_parallel_block
         self.begin_of_parallel_block = None
 
-        if self.error_label_used or self.acquire_gil:
+        if self.acquire_gil:
+            # The body runs with an attached thread state (which the loop of
+            # prange() only gives up between its iterations), also without OpenMP.
+            begin_code.put_ensure_gil(declare_gilstate=True)
+            for entry, original_cname, temp in self.python_privates:
+                begin_code.putln("%s = %s;" % (temp, original_cname))
+                begin_code.put_xincref(temp, entry.type)
+
+            self.cleanup_temps(code)
+            code.put_release_ensured_gil()
+
+        elif self.error_label_used:
             end_code = code
 
             begin_code.putln("#ifdef _OPENMP")
             begin_code.put_ensure_gil(declare_gilstate=True)
-            if not self.acquire_gil:
-                begin_code.putln("Py_BEGIN_ALLOW_THREADS")
+            begin_code.putln("Py_BEGIN_ALLOW_THREADS")
             begin_code.putln("#endif /* _OPENMP */")
 
             end_code.putln("#ifdef _OPENMP")
-            if not self.acquire_gil:
-                end_code.putln("Py_END_ALLOW_THREADS")
+            end_code.putln("Py_END_ALLOW_THREADS")
             end_code.putln("#else")
             end_code.put_safe("{\n")
             end_code.put_ensure_gil()
@@ -10500,13 +10804,13 @@ class ParallelStatNode(StatNode, ParallelNode):
                     self.error_label_used = True
                     self.fetch_parallel_exception(code)
 
-                code.putln("%s = %d;" % (Naming.parallel_why, i + 1))
+                code.putln("%s = %d;" % (self.parallel_why, i + 1))
             code.put_goto(dont_return_label)
 
         if self.any_label_used:
             code.put_label(dont_return_label)
 
-            if should_flush and self.breaking_label_used:
+            if should_flush and self.breaking_label_used and not self.threads_backend:
                 code.putln_openmp("#pragma omp flush(%s)" % Naming.parallel_why)
 
     def fetch_parallel_exception(self, code):
@@ -10538,22 +10842,23 @@ class ParallelStatNode(StatNode, ParallelNode):
         """
         code.begin_block()
         code.put_ensure_gil(declare_gilstate=True)
-        code.put_acquire_freethreading_lock()
+        code.put_acquire_freethreading_lock(self.parallel_freethreading_mutex)
 
-        code.putln_openmp("#pragma omp flush(%s)" % Naming.parallel_exc_type)
+        if not self.threads_backend:
+            code.putln_openmp("#pragma omp flush(%s)" % Naming.parallel_exc_type)
         code.putln(
-            "if (!%s) {" % Naming.parallel_exc_type)
+            "if (!%s) {" % self.parallel_exc[0])
 
         code.putln("__Pyx_ErrFetchWithState(&%s, &%s, &%s);" % self.parallel_exc)
         pos_info = chain(*zip(self.parallel_pos_info, self.pos_info))
         code.funcstate.uses_error_indicator = True
         code.putln("%s = %s; %s = %s; %s = %s;" % tuple(pos_info))
-        code.put_gotref(Naming.parallel_exc_type, py_object_type)
+        code.put_gotref(self.parallel_exc[0], py_object_type)
 
         code.putln(
             "}")
 
-        code.put_release_freethreading_lock()
+        code.put_release_freethreading_lock(self.parallel_freethreading_mutex)
         code.put_release_ensured_gil()
         code.end_block()
 
@@ -10563,9 +10868,14 @@ class ParallelStatNode(StatNode, ParallelNode):
         code.put_ensure_gil(declare_gilstate=True)
         code.put_acquire_freethreading_lock()
 
+        if self.threads_backend:
+            # The body function has no refnanny context of its own.
+            code.put_xgotref(Naming.parallel_exc_type, py_object_type)
         code.put_giveref(Naming.parallel_exc_type, py_object_type)
         code.putln("__Pyx_ErrRestoreWithState(%s, %s, %s);" % self.parallel_exc)
         pos_info = chain(*zip(self.pos_info, self.parallel_pos_info))
+        # the body may have raised in a separate function (parallel_backend="threads")
+        code.funcstate.should_declare_error_indicator = True
         code.putln("%s = %s; %s = %s; %s = %s;" % tuple(pos_info))
 
         code.put_release_freethreading_lock()
@@ -10670,6 +10980,308 @@ class ParallelStatNode(StatNode, ParallelNode):
         code.end_block()  # end parallel control flow block
         self.redef_builtin_expect_apple_gcc_bug(code)
 
+    def use_threads_backend(self, code):
+        """
+        Decide whether this section runs in Cython's own thread pool instead
+        of OpenMP, as requested by the 'parallel_backend' directive. Nested
+        sections always follow their outermost section. Sections that the
+        thread pool cannot run fall back to OpenMP with a warning.
+        """
+        if self.parent or code.globalstate.directives['parallel_backend'] != 'threads':
+            return False
+        unsupported = self.threads_backend_unsupported(code)
+        if unsupported:
+            warning(self.pos, "parallel_backend='threads' does not support %s, using OpenMP" % unsupported, 1)
+            return False
+        return True
+
+    def threads_backend_unsupported(self, code):
+        env = code.funcstate.scope
+        if self.acquire_gil:
+            return "parallel sections that hold the GIL"
+        if self.has_return:
+            return "returning from parallel sections"
+        if self.has_nested_section and not self.is_prange:
+            return "prange() inside of parallel() blocks"
+        if self.is_prange and not self.index_type.is_int:
+            return "non-integer loop indices"
+        if code.is_tracing():
+            return "profiling and line tracing"
+        if code.funcstate.outlined_code_writer is None:
+            return "parallel sections outside of functions"
+        if env.is_closure_scope or any(
+                entry.from_closure or entry.in_closure for entry in env.entries.values()):
+            return "functions with closures"
+        for entry in self.threads_backend_shared_entries(env) + list(self.privates):
+            if entry.type.is_buffer:
+                return "buffer variables"
+            if entry.type.is_reference or entry.type.is_fake_reference:
+                return "C++ references"
+            if entry in self.privates and entry.type.is_array:
+                return "private C arrays"
+        return None
+
+    def threads_backend_shared_entries(self, env):
+        shared = []
+        for entry in env.arg_entries + env.var_entries:
+            if entry in shared or (entry in self.privates and not entry.type.is_pyobject):
+                continue
+            if entry.is_arg or entry.used:
+                shared.append(entry)
+        return shared
+
+    def threads_backend_copied_privates(self, privates):
+        """
+        Returns the privates whose value from before the section the body
+        function can see, so that it needs a copy of them. These are the
+        privates that the section reads before assigning them, and for
+        prange() also those that an assignment in the loop may overwrite,
+        like the firstprivate() of the OpenMP backend, since the last chunk
+        writes them back.
+        """
+        from .FlowControl import NameAssignment
+        from .Visitor import TreeVisitor
+
+        class NamePositions(TreeVisitor):
+            def __init__(self):
+                super().__init__()
+                self.positions = set()
+
+            def visit_Node(self, node):
+                self.visitchildren(node)
+
+            def visit_NameNode(self, node):
+                self.positions.add(node.pos)
+
+        collector = NamePositions()
+        collector.visit(self.body)
+        body_positions = collector.positions
+
+        def sees_value_from_before(name_node):
+            return any(isinstance(assignment, NameAssignment) and assignment.pos not in body_positions
+                       for assignment in name_node.cf_state or ())
+
+        copied = []
+        for entry in privates:
+            name_nodes = [reference.node for reference in entry.cf_references]
+            if self.is_prange:
+                name_nodes += [assignment.lhs for assignment in entry.cf_assignments]
+            if any(name_node.pos in body_positions and sees_value_from_before(name_node)
+                   for name_node in name_nodes):
+                copied.append(entry)
+        return copied
+
+    reduction_identities = {
+        '+': '0', '-': '0', '|': '0', '^': '0', '*': '1', '&': '~0',
+    }
+
+    def generate_threads_backend_section(self, code, nsteps, generate_chunk,
+                                         ctx_values=(), schedule=None):
+        """
+        Run the section in Cython's thread pool (parallel_backend="threads").
+
+        The body becomes a separate C function that every thread of the team
+        calls. It takes chunks of 'nsteps' iterations from the team and passes
+        them to generate_chunk(), which generates the code for one chunk. The
+        function reaches the variables of the calling function through
+        pointers in a context struct, 'ctx_values' are further
+        (type, name, value) members of the struct. Privates whose earlier value
+        the section can see start from copies in the struct, as threads may join
+        after others changed the variable, and for prange() the thread that runs
+        the last chunk writes them back.
+        Reductions start from the identity of their operator in each thread
+        and get combined under the lock of the team.
+
+        Returns whether the body used its continue and break labels.
+        """
+        env = code.funcstate.scope
+        code.globalstate.use_utility_code(
+            UtilityCode.load_cached("ParallelThreadPool", "ThreadPool.c"))
+        func_cname = Naming.pyrex_prefix + env.global_scope().next_id("parallel_body")
+        ctx_type = "struct %s_ctx" % func_cname
+        ctx = Naming.parallel_ctx
+        team = Naming.parallel_team
+        begin, end = Naming.parallel_chunk_begin, Naming.parallel_chunk_end
+        ctx_values = list(ctx_values)
+        for reduction in self.element_reductions:
+            ctx_values.extend(reduction.buffer_values())
+
+        privates, reductions = [], []
+        for entry, op in sorted(self.privates.items()):
+            if self.is_prange and op and op in "+*-&^|" and entry != self.target.entry:
+                if entry.type.is_pyobject:
+                    error(self.pos, "Python objects cannot be reductions")
+                else:
+                    reductions.append((entry, op))
+            elif not entry.type.is_pyobject:
+                privates.append(entry)
+        shared = self.threads_backend_shared_entries(env)
+        lastprivates = privates if self.is_prange else []
+
+        # ------ the body function
+        writer = code.funcstate.outlined_code_writer.insertion_point()
+        ctx_decl_code = writer.insertion_point()
+        writer.enter_cfunc_scope(env)
+        writer.funcstate.gil_owned = False
+        writer.funcstate.parallel_thread_num = Naming.parallel_thread_num
+        writer.new_loop_labels()
+
+        writer.putln("")
+        writer.putln("static void %s(void *%s_arg, __pyx_parallel_team *%s, CYTHON_UNUSED int %s) {" % (
+            func_cname, ctx, team, Naming.parallel_thread_num))
+        writer.putln("CYTHON_UNUSED %s *%s = (%s *) %s_arg;" % (ctx_type, ctx, ctx_type, ctx))
+        copied_privates = self.threads_backend_copied_privates(privates)
+        for entry in privates:
+            if entry in copied_privates:
+                writer.putln("%s = %s->%s%s;" % (
+                    entry.type.declaration_code(entry.cname), ctx, Naming.parallel_firstprivate_prefix, entry.cname))
+            else:
+                writer.putln("%s;" % entry.type.declaration_code(entry.cname))
+        for entry, op in reductions:
+            writer.putln("%s = %s;" % (entry.type.declaration_code(entry.cname), self.reduction_identities[op]))
+        writer.putln("Py_ssize_t %s, %s;" % (begin, end))
+        refnanny_decl_code = writer.insertion_point()
+        temp_decl_code = writer.insertion_point()
+        gil_code = writer.insertion_point()
+
+        original_cnames = [(entry, entry.cname) for entry in shared]
+        for entry in shared:
+            entry.cname = "(*%s->%s)" % (ctx, entry.cname)
+        self.parallel_why = "(*%s->%s)" % (ctx, Naming.parallel_why)
+        self.parallel_exc = tuple("(*%s->%s)" % (ctx, cname) for cname in ParallelStatNode.parallel_exc)
+        self.parallel_pos_info = tuple("(*%s->%s)" % (ctx, cname) for cname in ParallelStatNode.parallel_pos_info)
+        self.parallel_freethreading_mutex = "(*%s->%s)" % (ctx, Naming.parallel_freethreading_mutex)
+
+        for reduction in self.element_reductions:
+            reduction.use_context(ctx)
+            reduction.init_private(writer, Naming.parallel_thread_num)
+
+        writer.putln("while (__Pyx_ParallelTeam_NextChunk(%s, %s, &%s, &%s)) {" % (
+            team, Naming.parallel_thread_num, begin, end))
+        generate_chunk(writer)
+        if lastprivates:
+            writer.putln("if (%s == (Py_ssize_t) %s->nsteps) {" % (end, ctx))
+            for entry in lastprivates:
+                writer.putln("*%s->%s = %s;" % (ctx, entry.cname, entry.cname))
+            writer.putln("}")
+        writer.putln("}")
+
+        if self.element_reductions:
+            self.merge_element_reductions(
+                writer, Naming.parallel_thread_num, "__Pyx_ParallelTeam_Size(%s)" % team, team=team)
+
+        for entry, cname in original_cnames:
+            entry.cname = cname
+        del self.parallel_why, self.parallel_exc, self.parallel_pos_info, self.parallel_freethreading_mutex
+
+        if self.error_label_used:
+            # Keep a thread state for the whole run, as in end_parallel_block()
+            gil_code.put_ensure_gil(declare_gilstate=True)
+            gil_code.putln("Py_BEGIN_ALLOW_THREADS")
+            writer.putln("Py_END_ALLOW_THREADS")
+            for temp, type in sorted(writer.funcstate.all_managed_temps()):
+                writer.put_xdecref_clear(temp, type, have_gil=True)
+            writer.put_release_ensured_gil()
+
+        if reductions:
+            writer.putln("__Pyx_ParallelTeam_Lock(%s);" % team)
+            for entry, op in reductions:
+                writer.putln("*%s->%s = *%s->%s %s %s;" % (
+                    ctx, entry.cname, ctx, entry.cname, '+' if op == '-' else op, entry.cname))
+            writer.putln("__Pyx_ParallelTeam_Unlock(%s);" % team)
+        writer.putln("}")
+        writer.putln("")
+
+        used_labels = writer.label_used(writer.continue_label), writer.label_used(writer.break_label)
+        if writer.funcstate.needs_refnanny:
+            refnanny_decl_code.put_declare_refcount_context()
+        temp_decl_code.put_temp_declarations(writer.funcstate)
+        writer.exit_cfunc_scope()
+
+        # ------ the context struct
+        if self.is_prange:
+            why_used = self.breaking_label_used
+        else:
+            why_used = self.any_label_used
+        members = [(type.declaration_code(name), name, value) for type, name, value in ctx_values]
+        for entry in copied_privates:
+            name = Naming.parallel_firstprivate_prefix + entry.cname
+            members.append((entry.type.declaration_code(name), name, entry.cname))
+        for entry in shared + lastprivates + [entry for entry, op in reductions]:
+            members.append((
+                PyrexTypes.c_ptr_type(entry.type).declaration_code(entry.cname),
+                entry.cname, "&" + entry.cname))
+        if why_used:
+            # threads poll it to skip the remaining iterations
+            members.append(("volatile int *" + Naming.parallel_why, Naming.parallel_why, "&" + Naming.parallel_why))
+        if self.error_label_used:
+            for decl, cnames in [("PyObject **", ParallelStatNode.parallel_exc),
+                                 ("const char **", ParallelStatNode.parallel_pos_info[:1]),
+                                 ("int *", ParallelStatNode.parallel_pos_info[1:])]:
+                for cname in cnames:
+                    members.append((decl + cname, cname, "&" + cname))
+
+        ctx_decl_code.putln("")
+        ctx_decl_code.putln("%s {" % ctx_type)
+        for decl, name, value in members:
+            ctx_decl_code.putln("%s;" % decl)
+        if self.error_label_used:
+            ctx_decl_code.putln("#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING")
+            ctx_decl_code.putln("PyMutex *%s;" % Naming.parallel_freethreading_mutex)
+            ctx_decl_code.putln("#endif")
+        ctx_decl_code.putln("};")
+
+        # ------ the call
+        if self.num_threads is not None:
+            num_threads = self.evaluate_num_threads(code)
+        else:
+            num_threads = "0"
+        if self.threading_condition is not None:
+            num_threads = "(%s) ? %s : 1" % (self.threading_condition.result(), num_threads)
+        if self.chunksize is not None:
+            chunksize = self.evaluate_before_block(code, self.chunksize)
+        else:
+            chunksize = "0"
+        schedule = {
+            'static': "__Pyx_PARALLEL_SCHEDULE_STATIC",
+            'dynamic': "__Pyx_PARALLEL_SCHEDULE_DYNAMIC",
+            'guided': "__Pyx_PARALLEL_SCHEDULE_GUIDED",
+        }.get(schedule, "__Pyx_PARALLEL_SCHEDULE_DEFAULT")
+
+        code.begin_block()
+        for entry in privates:
+            if entry not in copied_privates and entry not in lastprivates:
+                # Only the body function might use it.
+                code.putln("CYTHON_UNUSED_VAR(%s);" % entry.cname)
+        code.putln("%s %s;" % (ctx_type, ctx))
+        for decl, name, value in members:
+            code.putln("%s.%s = %s;" % (ctx, name, value))
+        if self.error_label_used:
+            code.putln("#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING")
+            code.putln("%s.%s = &%s;" % (ctx, Naming.parallel_freethreading_mutex, Naming.parallel_freethreading_mutex))
+            code.putln("#endif")
+        # The body function has no refnanny context of its own, so the objects
+        # that it may replace are handed over for the duration of the run.
+        assigned_objects = [entry for entry in shared if entry.type.is_pyobject and entry in self.assignments]
+        self.put_refnanny_handover(code, assigned_objects, code.put_xgiveref)
+        code.putln("__Pyx_ParallelPool_Run(%s, &%s, %s, %s, %s, %s);" % (
+            func_cname, ctx, nsteps, num_threads, schedule, chunksize))
+        self.put_refnanny_handover(code, assigned_objects, code.put_xgotref)
+        code.end_block()
+        return used_labels
+
+    def put_refnanny_handover(self, code, entries, put_ref):
+        if not entries:
+            return
+        code.putln("#if CYTHON_REFNANNY")
+        code.begin_block()
+        code.put_ensure_gil(declare_gilstate=True)
+        for entry in entries:
+            put_ref(entry.cname, entry.type)
+        code.put_release_ensured_gil()
+        code.end_block()
+        code.putln("#endif")
+
     # FIXME: improve with version number for OS X Lion
     buggy_platform_macro_condition = "(defined(__APPLE__) || defined(__OSX__))"
     have_expect_condition = "(defined(__GNUC__) && " \
@@ -10717,9 +11329,14 @@ class ParallelWithBlockNode(ParallelStatNode):
         if self.threading_condition is not None:
             self.threading_condition.generate_evaluation_code(code)
 
+        self.threads_backend = self.use_threads_backend(code)
         self.declare_closure_privates(code)
         self.setup_parallel_control_flow_block(code)
 
+        if self.threads_backend:
+            self.generate_threads_backend_block(code)
+            return
+
         code.putln("#ifdef _OPENMP")
         code.put("#pragma omp parallel ")
 
@@ -10743,10 +11360,12 @@ class ParallelWithBlockNode(ParallelStatNode):
         code.begin_block()  # parallel block
         self.begin_parallel_block(code)
         code.funcstate.start_collecting_temps()
+        self.privatize_python_objects(code)
         self.body.generate_execution_code(code)
         self.trap_parallel_exit(code)
         self.privatize_temps(code)
         self.end_parallel_block(code)
+        self.release_python_privates(code)
         code.end_block()  # end parallel block
 
         continue_ = code.label_used(code.continue_label)
@@ -10766,16 +11385,253 @@ class ParallelWithBlockNode(ParallelStatNode):
 
         self.release_closure_privates(code)
 
+    def generate_threads_backend_block(self, code):
+        """
+        Runs the block once in each thread of a team from Cython's thread
+        pool, which hands out one iteration to each thread for this.
+        """
+        def generate_chunk(code):
+            self.body.generate_execution_code(code)
+            self.trap_parallel_exit(code)
+
+        continue_, break_ = self.generate_threads_backend_section(code, "-1", generate_chunk)
+
+        self.restore_labels(code)
+        self.end_parallel_control_flow_block(code, break_=break_, continue_=continue_)
+
+        if self.threading_condition is not None:
+            self.threading_condition.generate_disposal_code(code)
+            self.threading_condition.free_temps(code)
+
+        self.release_closure_privates(code)
+
     def nogil_check(self, env):
         self._parameters_nogil_check(env, ['use_threads_if'], [self.threading_condition])
 
 
+class ParallelElementReduction:
+    """
+    A memoryview, C array or C struct variable whose items or fields the body
+    of a prange() loop with 'element_reduction' updates with in-place
+    operators. Each thread accumulates into its own slot of a buffer, which
+    starts from the identity of the operator, and the slots get merged into
+    the variable after the loop.
+
+    entry     Entry      the variable
+    fields    {field name or None: (operator, type)}
+              the reduced fields of structs, or the items of memoryviews
+              and arrays under None
+
+    During code generation:
+
+    buffer, slot_size, count    temps with the buffer, the (cache line
+                                aligned) size of a slot in bytes and the
+                                number of items in a slot
+    private                     temp with the slot of the current thread
+    target                      the cname of the variable itself
+    """
+
+    def __init__(self, entry):
+        self.entry = entry
+        self.fields = {}
+
+    def add(self, node, field):
+        op = node.operator
+        item_type = node.lhs.type
+        if op not in ('+', '-', '*', '&', '|', '^'):
+            error(node.pos, "Invalid element reduction operator '%s'" % op)
+        elif not (item_type.is_int or item_type.is_float):
+            error(node.pos, "Element reductions need C integer or floating point items, not '%s'" % item_type)
+        elif field in self.fields and self.fields[field][0] != op:
+            error(node.pos, "Reduction operator '%s' is inconsistent with previous reduction operator '%s'" % (
+                op, self.fields[field][0]))
+        else:
+            self.fields[field] = (op, item_type)
+
+    def check_type(self, pos):
+        type = self.entry.type
+        if type.is_memoryviewslice:
+            if any(access != 'direct' for access, packing in type.axes):
+                error(pos, "Element reductions are not supported for indirect memoryviews")
+        elif type.is_array:
+            while type.is_array:
+                if type.size is None:
+                    error(pos, "Element reductions need arrays of known size")
+                    break
+                type = type.base_type
+
+    def item_code(self):
+        return self.fields[None][1].empty_declaration_code()
+
+    def buffer_values(self):
+        # The members of the context struct of the thread pool backend.
+        return [(PyrexTypes.c_char_ptr_type, self.buffer, self.buffer),
+                (PyrexTypes.c_size_t_type, self.slot_size, self.slot_size),
+                (PyrexTypes.c_py_ssize_t_type, self.count, self.count)]
+
+    def use_context(self, ctx):
+        self.buffer_code, self.slot_size_code, self.count_code = [
+            "%s->%s" % (ctx, name) for name in (self.buffer, self.slot_size, self.count)]
+
+    def slot(self, thread_num):
+        return "(%s + (size_t) (%s) * %s)" % (self.buffer_code, thread_num, self.slot_size_code)
+
+    def allocate_buffer(self, code, max_threads):
+        entry, type = self.entry, self.entry.type
+        self.buffer = code.funcstate.allocate_temp(PyrexTypes.c_char_ptr_type, manage_ref=False)
+        self.slot_size = code.funcstate.allocate_temp(PyrexTypes.c_size_t_type, manage_ref=False)
+        self.count = code.funcstate.allocate_temp(PyrexTypes.c_py_ssize_t_type, manage_ref=False)
+        self.buffer_code, self.slot_size_code, self.count_code = self.buffer, self.slot_size, self.count
+
+        if type.is_memoryviewslice:
+            count = " * ".join("%s.shape[%d]" % (entry.cname, dim) for dim in range(type.ndim))
+            item_size = "sizeof(%s)" % self.item_code()
+        elif type.is_array:
+            count = "sizeof(%s) / sizeof(%s)" % (entry.cname, self.item_code())
+            item_size = "sizeof(%s)" % self.item_code()
+        else:
+            count = "1"
+            item_size = "sizeof(%s)" % type.empty_declaration_code()
+        code.putln("%s = %s;" % (self.count, count))
+        # Round up to whole cache lines, so that the threads do not share them.
+        code.putln("%s = ((size_t) %s * %s + 63) & ~((size_t) 63);" % (self.slot_size, self.count, item_size))
+        code.putln("%s = (char *) malloc(%s ? (size_t) %s * %s : 1);" % (
+            self.buffer, self.slot_size, max_threads, self.slot_size))
+
+    def free_buffer(self, code):
+        code.putln("free(%s);" % self.buffer)
+
+    def release_buffer(self, code):
+        for temp in (self.buffer, self.slot_size, self.count):
+            code.funcstate.release_temp(temp)
+
+    def init_private(self, code, thread_num):
+        """
+        Point the private variable of this thread to its slot and fill it with
+        the identity of the operators. The body then uses the private variable
+        instead of the variable itself.
+        """
+        entry, type = self.entry, self.entry.type
+        slot = self.slot(thread_num)
+        identities = ParallelStatNode.reduction_identities
+        self.target = entry.cname
+
+        if type.is_memoryviewslice:
+            self.private = code.funcstate.allocate_temp(type, manage_ref=False)
+            code.putln("%s = %s;" % (self.private, self.target))
+            code.putln("%s.data = %s;" % (self.private, slot))
+            # Lay out the items like the slice type expects them, i.e. in
+            # Fortran order if the first dimension is contiguous.
+            dims = list(range(type.ndim))
+            if not (type.ndim > 1 and type.axes[0][1] == 'contig'):
+                dims.reverse()
+            code.putln("%s.strides[%d] = sizeof(%s);" % (self.private, dims[0], self.item_code()))
+            for previous, dim in zip(dims, dims[1:]):
+                code.putln("%s.strides[%d] = %s.strides[%d] * %s.shape[%d];" % (
+                    self.private, dim, self.private, previous, self.private, previous))
+            entry.cname = self.private
+        elif type.is_array:
+            self.private = code.funcstate.allocate_temp(PyrexTypes.c_ptr_type(type.base_type), manage_ref=False)
+            code.putln("%s = (%s) %s;" % (
+                self.private, PyrexTypes.c_ptr_type(type.base_type).empty_declaration_code(), slot))
+            entry.cname = self.private
+        else:
+            self.private = code.funcstate.allocate_temp(PyrexTypes.c_ptr_type(type), manage_ref=False)
+            code.putln("%s = (%s *) %s;" % (self.private, type.empty_declaration_code(), slot))
+            for field, (op, field_type) in self.fields.items():
+                code.putln("%s->%s = %s;" % (self.private, type.scope.lookup(field).cname, identities[op]))
+            entry.cname = "(*%s)" % self.private
+            return
+
+        op, item_type = self.fields[None]
+        item = self.item_code()
+        code.putln("{")
+        code.putln("%s *__pyx_temp_items = (%s *) %s;" % (item, item, slot))
+        code.putln("Py_ssize_t __pyx_temp_idx;")
+        code.putln("for (__pyx_temp_idx = 0; __pyx_temp_idx < %s; __pyx_temp_idx++) {" % self.count_code)
+        code.putln("__pyx_temp_items[__pyx_temp_idx] = %s;" % identities[op])
+        code.putln("}")
+        code.putln("}")
+
+    def release_private(self, code):
+        self.entry.cname = self.target
+        code.funcstate.release_temp(self.private)
+
+    def put_combine_slots(self, code, thread_num, other_thread_num):
+        """
+        Add the slot of 'other_thread_num' to the slot of 'thread_num'.
+        """
+        type = self.entry.type
+        if type.is_struct_or_union:
+            struct = type.empty_declaration_code()
+            for field, (op, field_type) in self.fields.items():
+                cname = type.scope.lookup(field).cname
+                code.putln("((%s *) %s)->%s %s= ((%s *) %s)->%s;" % (
+                    struct, self.slot(thread_num), cname, '+' if op == '-' else op,
+                    struct, self.slot(other_thread_num), cname))
+            return
+
+        op, item_type = self.fields[None]
+        item = self.item_code()
+        code.putln("{")
+        code.putln("%s *__pyx_temp_items = (%s *) %s;" % (item, item, self.slot(thread_num)))
+        code.putln("%s *__pyx_temp_other_items = (%s *) %s;" % (item, item, self.slot(other_thread_num)))
+        code.putln("Py_ssize_t __pyx_temp_idx;")
+        code.putln("for (__pyx_temp_idx = 0; __pyx_temp_idx < %s; __pyx_temp_idx++) {" % self.count_code)
+        code.putln("__pyx_temp_items[__pyx_temp_idx] %s= __pyx_temp_other_items[__pyx_temp_idx];" % (
+            '+' if op == '-' else op))
+        code.putln("}")
+        code.putln("}")
+
+    def put_merge(self, code, atomic):
+        """
+        Add the slot of the current thread to the variable, with an OpenMP
+        atomic operation for each item if 'atomic' is true.
+        """
+        from .MemoryView import ElementLoop
+        type = self.entry.type
+
+        def put_update(lhs, op, rhs):
+            if atomic:
+                code.putln("#ifdef _OPENMP")
+                code.putln("#pragma omp atomic")
+                code.putln("#endif")
+            code.putln("%s %s= %s;" % (lhs, '+' if op == '-' else op, rhs))
+
+        if type.is_struct_or_union:
+            for field, (op, field_type) in self.fields.items():
+                cname = type.scope.lookup(field).cname
+                put_update("%s.%s" % (self.target, cname), op, "%s->%s" % (self.private, cname))
+            return
+
+        op, item_type = self.fields[None]
+        code.putln("{")
+        if type.is_memoryviewslice:
+            loop = ElementLoop(code, [(self.target, type), (self.private, type)])
+            loop.put_declarations()
+            loop.start_loops()
+            put_update("(*%s)" % loop.element_pointer(0), op, "(*%s)" % loop.element_pointer(1))
+            loop.end_loops()
+        else:
+            item = self.item_code()
+            code.putln("%s *__pyx_temp_items = (%s *) %s;" % (item, item, self.target))
+            code.putln("%s *__pyx_temp_private_items = (%s *) %s;" % (item, item, self.private))
+            code.putln("Py_ssize_t __pyx_temp_idx;")
+            code.putln("for (__pyx_temp_idx = 0; __pyx_temp_idx < %s; __pyx_temp_idx++) {" % self.count_code)
+            put_update("__pyx_temp_items[__pyx_temp_idx]", op, "__pyx_temp_private_items[__pyx_temp_idx]")
+            code.putln("}")
+        code.putln("}")
+
+
 class ParallelRangeNode(ParallelStatNode):
     """
     This node represents a 'for i in cython.parallel.prange():' construct.
 
     target       NameNode       the target iteration variable
     else_clause  Node or None   the else clause of this loop
+
+    element_reduction   None, 'atomic' or 'tree', how to merge the
+                        per-thread copies of self.element_reductions
     """
 
     child_attrs = ['body', 'target', 'else_clause', 'args', 'num_threads',
@@ -10790,8 +11646,10 @@ class ParallelRangeNode(ParallelStatNode):
     nogil = None
     acquire_gil = False
     schedule = None
+    element_reduction = None
 
-    valid_keyword_arguments = ['schedule', 'nogil', 'num_threads', 'chunksize', 'use_threads_if']
+    valid_keyword_arguments = ['schedule', 'nogil', 'num_threads', 'chunksize', 'use_threads_if',
+                               'element_reduction']
 
     class DummyIteratorNode(Node):
         child_attrs = ["args"]
@@ -10822,6 +11680,9 @@ class ParallelRangeNode(ParallelStatNode):
         if self.schedule not in (None, 'static', 'dynamic', 'guided', 'runtime'):
             error(self.pos, "Invalid schedule argument to prange: %s" % (self.schedule,))
 
+        if self.element_reduction not in (None, 'atomic', 'tree'):
+            error(self.pos, "Invalid element_reduction argument to prange: %s" % (self.element_reduction,))
+
     def analyse_expressions(self, env):
         was_nogil = env.nogil
         if self.nogil:
@@ -10894,6 +11755,9 @@ class ParallelRangeNode(ParallelStatNode):
             node.chunksize = node.chunksize.coerce_to(
                 PyrexTypes.c_int_type, env).coerce_to_temp(env)
 
+        if node.element_reduction:
+            node.analyse_element_reductions()
+
         if node.nogil:
             env.nogil = was_nogil
 
@@ -10908,6 +11772,33 @@ class ParallelRangeNode(ParallelStatNode):
             parent.assigned_nodes.extend(node.assigned_nodes)
         return node
 
+    def analyse_element_reductions(self):
+        """
+        Find the memoryviews, C arrays and structs whose items or fields the
+        body updates with in-place operators. The body must not use them
+        otherwise, as each thread only sees its own part of the result.
+        """
+        from .ParseTreeTransforms import ParallelElementReductionCollector
+
+        if self.parent:
+            error(self.pos, "element_reduction is not supported in nested parallel sections")
+            return
+
+        collector = ParallelElementReductionCollector()(self.body)
+        reductions = {}
+        for node, name, field in collector.reductions:
+            reduction = reductions.get(name.entry)
+            if reduction is None:
+                reduction = reductions[name.entry] = ParallelElementReduction(name.entry)
+                reduction.check_type(name.pos)
+            reduction.add(node, field)
+
+        for name in collector.names:
+            if name.entry in reductions:
+                error(name.pos, "Element reduction variable '%s' can only be used in in-place operators" % name.name)
+
+        self.element_reductions = list(reductions.values())
+
     def nogil_check(self, env):
         names = 'start', 'stop', 'step', 'target', 'use_threads_if'
         nodes = self.start, self.stop, self.step, self.target, self.threading_condition
@@ -10953,6 +11844,7 @@ class ParallelRangeNode(ParallelStatNode):
 
             4) release our temps and write back any private closure variables
         """
+        self.threads_backend = self.use_threads_backend(code)
         self.declare_closure_privates(code)
 
         # This can only be a NameNode
@@ -10982,7 +11874,11 @@ class ParallelRangeNode(ParallelStatNode):
         if self.threading_condition is not None:
             self.threading_condition.generate_evaluation_code(code)
 
-        fmt_dict['i'] = code.funcstate.allocate_temp(self.index_type, False)
+        if self.element_reductions:
+            self.allocate_element_reduction_buffers(code)
+
+        if not self.threads_backend:
+            fmt_dict['i'] = code.funcstate.allocate_temp(self.index_type, False)
         fmt_dict['nsteps'] = code.funcstate.allocate_temp(self.index_type, False)
 
         # TODO: check if the step is 0 and if so, raise an exception in a
@@ -11004,11 +11900,30 @@ class ParallelRangeNode(ParallelStatNode):
         # shut up compiler warnings caused by lastprivate, as the compiler
         # erroneously believes that nsteps may be <= 0, leaving the private
         # target index uninitialized
+        # The thread that runs the last iteration passes out its references
+        # to Python object privates through shared temps.
+        # The thread pool does not run sections that hold the GIL, and only those have Python privates.
+        self.python_lastprivates = []
+        if not self.threads_backend:
+            for entry in self.python_private_entries():
+                temp = code.funcstate.allocate_temp(entry.type, manage_ref=False)
+                code.putln("%s = NULL;" % temp)
+                self.python_lastprivates.append((entry, temp))
+
         code.putln("if (%(nsteps)s > 0)" % fmt_dict)
         code.begin_block()  # if block
-        self.generate_loop(code, fmt_dict)
+        if self.threads_backend:
+            self.generate_threads_backend_loop(code, fmt_dict)
+        else:
+            self.generate_loop(code, fmt_dict)
         code.end_block()  # end if block
 
+        for reduction in self.element_reductions:
+            reduction.free_buffer(code)
+
+        if self.python_lastprivates:
+            self.generate_python_lastprivates_assignment(code)
+
         self.restore_labels(code)
 
         if self.else_clause:
@@ -11033,11 +11948,148 @@ class ParallelRangeNode(ParallelStatNode):
                 temp.generate_disposal_code(code)
                 temp.free_temps(code)
 
-        code.funcstate.release_temp(fmt_dict['i'])
+        if not self.threads_backend:
+            code.funcstate.release_temp(fmt_dict['i'])
         code.funcstate.release_temp(fmt_dict['nsteps'])
+        for entry, temp in self.python_lastprivates:
+            code.funcstate.release_temp(temp)
+        for reduction in self.element_reductions:
+            reduction.release_buffer(code)
 
         self.release_closure_privates(code)
 
+    def allocate_element_reduction_buffers(self, code):
+        """
+        Allocate the buffers of the element reductions, with a slot for each
+        thread that the loop may run in. This evaluates num_threads early.
+        """
+        if self.acquire_gil:
+            error(self.pos, "element_reduction is not supported in prange() loops that hold the GIL")
+
+        num_threads = None
+        if self.num_threads is not None:
+            self.num_threads.generate_evaluation_code(code)
+            num_threads = self.num_threads_result = self.num_threads.result()
+
+        max_threads = code.funcstate.allocate_temp(PyrexTypes.c_int_type, manage_ref=False)
+        if self.threads_backend:
+            code.globalstate.use_utility_code(
+                UtilityCode.load_cached("ParallelThreadPool", "ThreadPool.c"))
+            code.putln("%s = __Pyx_ParallelPool_MaxThreads(%s);" % (max_threads, num_threads or "0"))
+        else:
+            code.putln("#ifdef _OPENMP")
+            if num_threads is None:
+                code.putln("%s = omp_get_max_threads();" % max_threads)
+            else:
+                code.putln("%s = (%s > 0) ? %s : omp_get_max_threads();" % (max_threads, num_threads, num_threads))
+            code.putln("#else")
+            code.putln("%s = 1;" % max_threads)
+            code.putln("#endif")
+
+        code.globalstate.use_utility_code(UtilityCode.load_cached("IncludeStdlibH", "ModuleSetupCode.c"))
+        for reduction in self.element_reductions:
+            reduction.allocate_buffer(code, max_threads)
+        code.funcstate.release_temp(max_threads)
+
+        buffers = [reduction.buffer for reduction in self.element_reductions]
+        code.putln("if (unlikely(!%s)) {" % " || !".join(buffers))
+        for buffer in buffers:
+            code.putln("free(%s);" % buffer)
+        code.putln("{")
+        code.put_ensure_gil()
+        code.putln("PyErr_NoMemory();")
+        code.put_release_ensured_gil()
+        code.putln("}")
+        code.putln(code.error_goto(self.pos))
+        code.putln("}")
+
+    def merge_element_reductions(self, code, thread_num, num_threads=None, team=None):
+        """
+        Merge the slots of the element reductions into their variables after
+        the loop, and make the body use the variables again.
+
+        With 'atomic', each thread adds its slot to the variables when it is
+        done, with an atomic operation for each item under OpenMP and under
+        the lock of the team in the thread pool. With 'tree', the threads add
+        up their slots pairwise in log2(num_threads) rounds, and the first
+        thread adds the sum to the variables.
+        """
+        if self.element_reduction == 'atomic':
+            if team:
+                code.putln("__Pyx_ParallelTeam_Lock(%s);" % team)
+            for reduction in self.element_reductions:
+                reduction.put_merge(code, atomic=team is None)
+            if team:
+                code.putln("__Pyx_ParallelTeam_Unlock(%s);" % team)
+        else:
+            code.putln("{")
+            code.putln("int __pyx_temp_step;")
+            code.putln("for (__pyx_temp_step = 1; __pyx_temp_step < %s; __pyx_temp_step *= 2) {" % num_threads)
+            if team:
+                code.putln("__Pyx_ParallelTeam_Barrier(%s);" % team)
+            else:
+                code.putln("#ifdef _OPENMP")
+                code.putln("#pragma omp barrier")
+                code.putln("#endif")
+            code.putln("if (%s %% (2 * __pyx_temp_step) == 0 && %s + __pyx_temp_step < %s) {" % (
+                thread_num, thread_num, num_threads))
+            for reduction in self.element_reductions:
+                reduction.put_combine_slots(code, thread_num, "%s + __pyx_temp_step" % thread_num)
+            code.putln("}")
+            code.putln("}")
+            code.putln("}")
+            code.putln("if (%s == 0) {" % thread_num)
+            for reduction in self.element_reductions:
+                reduction.put_merge(code, atomic=False)
+            code.putln("}")
+
+        for reduction in self.element_reductions:
+            reduction.release_private(code)
+
+    def generate_python_lastprivates_assignment(self, code):
+        code.putln("if (%s) {" % " || ".join(temp for entry, temp in self.python_lastprivates))
+        code.put_ensure_gil(declare_gilstate=True)
+        for entry, temp in self.python_lastprivates:
+            code.putln("if (%s) {" % temp)
+            code.put_xdecref_set(entry.cname, entry.type, temp)
+            code.putln("}")
+        code.put_release_ensured_gil()
+        code.putln("}")
+
+    def generate_threads_backend_loop(self, code, fmt_dict):
+        """
+        Runs the loop in Cython's thread pool, where each thread executes
+        the chunks of iterations
+
+            for (i = begin; i < end; i++) {
+                target = start + step * i;
+                ...
+            }
+        """
+        ctx = Naming.parallel_ctx
+        ctx_values = [(self.index_type, name, fmt_dict[name]) for name in ('start', 'step', 'nsteps')]
+
+        def generate_chunk(code):
+            i = code.funcstate.allocate_temp(self.index_type, False)
+            index_type = self.index_type.empty_declaration_code()
+            code.putln("for (%s = (%s) %s; %s < (%s) %s; %s++)" % (
+                i, index_type, Naming.parallel_chunk_begin, i, index_type, Naming.parallel_chunk_end, i))
+            code.begin_block()  # for loop block
+            guard_around_body_codepoint = code.insertion_point()
+            code.begin_block()
+            code.putln("%s = (%s)(%s->start + %s->step * %s);" % (
+                fmt_dict['target'], fmt_dict['target_type'], ctx, ctx, i))
+            self.body.generate_execution_code(code)
+            self.trap_parallel_exit(code, should_flush=True)
+            if self.breaking_label_used:
+                guard_around_body_codepoint.putln("if (%s < 2)" % self.parallel_why)
+            code.end_block()  # end guard around loop body
+            code.end_block()  # end for loop block
+            code.funcstate.release_temp(i)
+
+        self.generate_threads_backend_section(
+            code, fmt_dict['nsteps'], generate_chunk, ctx_values, self.schedule)
+
     def generate_loop(self, code, fmt_dict):
         if self.is_nested_prange:
             code.putln("#if 0")
@@ -11065,6 +12117,23 @@ class ParallelRangeNode(ParallelStatNode):
             # Initialize the GIL if needed for this thread
             self.begin_parallel_block(code)
 
+            if self.element_reductions:
+                # The thread number, and the team size for the 'tree' merge.
+                reduction_threads = [
+                    code.funcstate.allocate_temp(PyrexTypes.c_int_type, manage_ref=False)
+                    for _ in range(2 if self.element_reduction == 'tree' else 1)]
+                code.putln("#ifdef _OPENMP")
+                for temp, omp_function in zip(reduction_threads, ["omp_get_thread_num", "omp_get_num_threads"]):
+                    code.putln("%s = %s();" % (temp, omp_function))
+                code.putln("#else")
+                for temp, value in zip(reduction_threads, [0, 1]):
+                    code.putln("%s = %d;" % (temp, value))
+                code.putln("#endif")
+                for reduction in self.element_reductions:
+                    reduction.init_private(code, reduction_threads[0])
+                reduction_codepoint.put(" private(%s)" % ", ".join(
+                    reduction_threads + [reduction.private for reduction in self.element_reductions]))
+
             if self.is_nested_prange:
                 code.putln("#if 0")
             else:
@@ -11129,9 +12198,17 @@ class ParallelRangeNode(ParallelStatNode):
         if self.is_parallel and not self.is_nested_prange:
             # nested pranges are not omp'ified, temps go to outer loops
             code.funcstate.start_collecting_temps()
+            self.privatize_python_objects(code)
 
         self.body.generate_execution_code(code)
         self.trap_parallel_exit(code, should_flush=True)
+        if self.python_lastprivates:
+            # After the labels of trap_parallel_exit(), to also run after a "continue".
+            code.putln("if (%(i)s == %(nsteps)s - 1) {" % fmt_dict)
+            for (entry, lastprivate_temp), (_, _, temp) in zip(self.python_lastprivates, self.python_privates):
+                code.putln("%s = %s;" % (lastprivate_temp, temp))
+                code.put_xincref(lastprivate_temp, entry.type)
+            code.putln("}")
         if self.is_parallel and not self.is_nested_prange:
             # nested pranges are not omp'ified, temps go to outer loops
             self.privatize_temps(code)
@@ -11144,6 +12221,9 @@ class ParallelRangeNode(ParallelStatNode):
         code.end_block()  # end guard around loop body
         code.end_block()  # end for loop block
 
+        if self.is_parallel and self.element_reductions:
+            self.merge_element_reductions(code, *reduction_threads)
+
         if self.acquire_gil:
             code.putln("#ifdef _OPENMP")
             code.putln(f"if (!{Naming.parallel_loop_threadstate}) {{")
@@ -11157,8 +12237,13 @@ class ParallelRangeNode(ParallelStatNode):
         if self.is_parallel:
             # Release the GIL and deallocate the thread state
             self.end_parallel_block(code)
+            self.release_python_privates(code)
             code.end_block()  # pragma omp parallel end block
 
+            if self.element_reductions:
+                for temp in reduction_threads:
+                    code.funcstate.release_temp(temp)
+
 
 class CnameDecoratorNode(StatNode):
     """
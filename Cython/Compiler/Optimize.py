@@ -29,6 +29,7 @@ from . import Visitor
 from . import Builtin
 from . import UtilNodes
 from . import Options
+from . import MemoryView
 
 from .Code import UtilityCode, TempitaUtilityCode
 from .StringEncoding import EncodedString, bytes_literal, encoded_string
@@ -1614,13 +1615,13 @@ class FlattenInListTransform(Visitor.VisitorTransform, SkipDeclarations):
     visit_Node = Visitor.VisitorTransform.recurse_to_children
 
 
-class DropRefcountingTransform(Visitor.VisitorTransform):
+class DropRefcountingTransform(Visitor.CythonTransform):
     """Drop ref-counting in safe places.
     """
     visit_Node = Visitor.VisitorTransform.recurse_to_children
 
     in_return_or_yield = False
-    in_parallel = False
+    parallel_sections = ()
 
     def visit_ParallelAssignmentNode(self, node):
         """
@@ -1741,10 +1742,19 @@ class DropRefcountingTransform(Visitor.VisitorTransform):
     def visit_YieldExprNode(self, node):
         return self.visit_ReturnStatNode(node)
 
+    def visit_CallNode(self, node):
+        # Slices in the arguments of a call in a return statement are
+        # not returned themselves.
+        in_return_or_yield, self.in_return_or_yield = self.in_return_or_yield, False
+        result = self.visit_Node(node)
+        self.in_return_or_yield = in_return_or_yield
+        return result
+
     def visit_ParallelStatNode(self, node):
-        in_parallel, self.in_parallel = self.in_parallel, True
+        parallel_sections = self.parallel_sections
+        self.parallel_sections = parallel_sections + (node,)
         result = self.visit_Node(node)
-        self.in_parallel = in_parallel
+        self.parallel_sections = parallel_sections
         return result
 
     def visit_MemoryViewSliceNode(self, node):
@@ -1753,11 +1763,15 @@ class DropRefcountingTransform(Visitor.VisitorTransform):
             return result
         if self.in_return_or_yield:
             return result
-        if self.in_parallel:
-            # TODO - I'd like to apply a looser set of rules here.
-            # However parallel blocks appear to do some cleanup even on unmanaged temps.
-            # This needs a further look to see if it's a wider bug, but right now it
-            # means we have to exclude all slicing in parallel from the optimization.
+        if self.current_directives['borrowed_slices']:
+            # The user promises that the sliced memoryview stays alive and
+            # unchanged while the slice is in use.
+            base = node.base
+            while base.is_attribute and not (base.is_py_attr or base.is_temp):
+                base = base.obj
+            if base.is_name and not base.is_temp:
+                node.use_borrowed_ref = True
+                node.use_managed_ref = False
             return result
         # What we're trying to work out is whether we can drop
         # the reference counting for the temp.
@@ -1791,9 +1805,10 @@ class DropRefcountingTransform(Visitor.VisitorTransform):
         for assignment in entry.cf_assignments:
             if assignment.assignment_type in unsafe_assigment_types:
                 return result
-            if self.in_parallel and not assignment.is_arg:
-                # If we're in a parallel block, take the view that
-                # we can't reason about any assignment to the rhs.
+        # Variables that a parallel section assigns to are private to
+        # each thread, or (like reductions) copied back at its end.
+        for section in self.parallel_sections:
+            if entry in section.assignments:
                 return result
 
         node.use_borrowed_ref = True
@@ -5562,3 +5577,324 @@ class ConsolidateOverflowCheck(Visitor.CythonTransform):
         else:
             self.visitchildren(node)
         return node
+
+
+class _AssignedEntriesCollector(Visitor.TreeVisitor):
+    """
+    Collects the entries of all names that a subtree assigns to or deletes,
+    and separately those whose address it takes or that it passes by C++ reference.
+    """
+    def __init__(self):
+        Visitor.TreeVisitor.__init__(self)
+        self.assigned_entries = set()
+        self.escaped_entries = set()
+
+    visit_Node = Visitor.TreeVisitor.visitchildren
+
+    def visit_NameNode(self, node):
+        parent = attr = None
+        for parent, attr, _ in reversed(self.access_path):
+            # look through unpacking assignments
+            if not (isinstance(parent, ExprNodes.StarredUnpackingNode)
+                    or getattr(parent, 'is_sequence_constructor', False)):
+                break
+        if attr is None:
+            return
+        if isinstance(parent, ExprNodes.AmpersandNode):
+            self.escaped_entries.add(node.entry)
+        elif attr in ('lhs', 'lhs_list') or attr.endswith('target') or isinstance(parent, Nodes.DelStatNode):
+            self.assigned_entries.add(node.entry)
+
+    def visit_SimpleCallNode(self, node):
+        self.visitchildren(node)
+        func_type = node.function_type()
+        if not func_type.is_cfunction or not node.args:
+            return
+        for arg, func_arg in zip(node.args, func_type.args):
+            if arg.is_name and (func_arg.type.is_reference or func_arg.type.is_rvalue_reference):
+                self.escaped_entries.add(arg.entry)
+
+
+def _is_private_local(entry):
+    return (entry is not None and (entry.is_local or entry.is_arg)
+            and not (entry.in_closure or entry.from_closure))
+
+
+def _collect_assigned_entries(*nodes):
+    collector = _AssignedEntriesCollector()
+    for node in nodes:
+        if node is not None:
+            collector.visit(node)
+    return collector
+
+
+class LoopIndexBoundsAnalysis(Visitor.CythonTransform):
+    """
+    Removes the bounds checks and the wraparound handling of memoryview
+    indexing with the loop variable of a range() loop where the loop range
+    shows that the index is within bounds, e.g. for "mv[i]" in
+
+        for i in range(mv.shape[0]):
+
+    For other loop ranges like "range(start, stop)", the loop evaluates a
+    single guard before its first iteration, "0 <= start and stop <= mv.shape[0]",
+    and the indexing only checks the bounds if the guard fails.  A signed loop
+    variable of a narrower type than the bounds also needs the guard to check that
+    it can hold them.
+
+    This requires that the loop body does not modify the loop variable or the
+    memoryview, so both must be local variables that are not used by closures
+    and whose address is not taken anywhere in the function.
+    """
+    # {loop variable entry: _IndexedRangeLoop}
+    loops = None
+    # {ResultRefNode: temp expression of the enclosing LetNode}
+    temp_expressions = None
+    # entries of the current function that pointers or C++ references may modify
+    escaped_entries = frozenset()
+
+    def visit_ModuleNode(self, node):
+        self.loops = {}
+        self.temp_expressions = {}
+        self.visitchildren(node)
+        return node
+
+    def visit_FuncDefNode(self, node):
+        outer_loops, outer_escaped_entries = self.loops, self.escaped_entries
+        self.loops = {}
+        self.escaped_entries = _collect_assigned_entries(node.body).escaped_entries
+        self.visitchildren(node)
+        self.loops, self.escaped_entries = outer_loops, outer_escaped_entries
+        return node
+
+    def visit_LetNode(self, node):
+        self.temp_expressions[node.lazy_temp] = node.temp_expression
+        self.visitchildren(node)
+        del self.temp_expressions[node.lazy_temp]
+        return node
+
+    def visit_ForFromStatNode(self, node):
+        target = node.target
+        if not (node.from_range and target.is_name and target.type.is_int
+                and _is_private_local(target.entry)):
+            self.visitchildren(node)
+            return node
+
+        self.visitchildren(node, exclude=('body',))
+        assigned_entries = _collect_assigned_entries(node.bound1, node.step, node.body).assigned_entries
+        assigned_entries.update(self.escaped_entries)
+        if target.entry in assigned_entries:
+            self.visitchildren(node, attrs=('body',))
+            return node
+
+        self.loops[target.entry] = _IndexedRangeLoop(self, node, assigned_entries)
+        self.visitchildren(node, attrs=('body',))
+        del self.loops[target.entry]
+        return node
+
+    def visit_ParallelStatNode(self, node):
+        if self.current_directives['parallel_backend'] != 'threads':
+            self.visitchildren(node)
+            return node
+        # The thread pool backend moves the section into a separate C function,
+        # which cannot use the guards of the enclosing loops.
+        outer_loops, self.loops = self.loops, {}
+        self.visitchildren(node)
+        self.loops = outer_loops
+        return node
+
+    def visit_MemoryViewIndexNode(self, node):
+        self.visitchildren(node)
+        if not (self.loops and node.is_memview_index):
+            return node
+        if not (self.current_directives['boundscheck'] or self.current_directives['wraparound']):
+            return node
+        base = node.base
+        if base.is_nonecheck:
+            base = base.arg
+        if not (base.is_name and _is_private_local(base.entry)):
+            return node
+
+        index_bounds = []
+        for dim, index in enumerate(node.indices):
+            loop = self.loops.get(index.entry) if index.is_name else None
+            index_bounds.append(loop.index_bound(base, dim) if loop is not None else None)
+        if any(bound is not None for bound in index_bounds):
+            node.index_bounds = index_bounds
+        return node
+
+    def is_shape_expression(self, node, entry, dim):
+        """
+        Tests if the node calculates "mv.shape[dim]" or "len(mv)" for the memoryview 'entry'.
+        Coercions of the bound can be ignored because narrowing a non-negative
+        value can only make it smaller or negative, which ends the loop earlier.
+        Narrowing to the loop variable type is up to narrowed_range_bounds().
+        """
+        while True:
+            if isinstance(node, ExprNodes.CoercionNode):
+                node = node.arg
+            elif isinstance(node, ExprNodes.TypecastNode):
+                node = node.operand
+            elif isinstance(node, UtilNodes.ResultRefNode):
+                node = self.temp_expressions.get(node)
+                if node is None:
+                    return False
+            else:
+                break
+
+        if isinstance(node, ExprNodes.PythonCapiCallNode):
+            if node.function.cname != "__Pyx_MemoryView_Len" or dim != 0:
+                return False
+            obj = node.args[0]
+        elif isinstance(node, ExprNodes.IndexNode) and node.base.is_attribute and node.base.attribute == 'shape':
+            if node.index.constant_result != dim:
+                return False
+            obj = node.base.obj
+        else:
+            return False
+        if obj.is_nonecheck:
+            obj = obj.arg
+        return obj.is_name and obj.entry is entry
+
+
+class _IndexedRangeLoop:
+    """
+    The loop variable range of a range() loop that memoryview indexing can rely on.
+    """
+    def __init__(self, analysis, node, assigned_entries):
+        self.analysis = analysis
+        self.node = node
+        self.assigned_entries = assigned_entries
+        (self.lower, lower_exclusive), (self.upper, self.upper_exclusive) = node.range_bounds()
+        lower_value = self.lower.constant_result
+        self.lower_known = not node.target.type.signed or (
+            isinstance(lower_value, int) and lower_value >= (-1 if lower_exclusive else 0))
+        # A narrower signed loop variable only stays within the bounds if it can hold them.
+        # Larger steps could still overflow it.
+        self.narrowed_bounds = node.narrowed_range_bounds()
+        self.step_overflows = bool(self.narrowed_bounds) and node.step is not None and node.step.constant_result != 1
+
+    def index_bound(self, base, dim):
+        """
+        Returns True if the loop variable is within the bounds of dimension 'dim'
+        of the memoryview 'base', the loop node if its guard needs to tell,
+        or None if the index must be checked.
+        """
+        if base.entry in self.assigned_entries or self.step_overflows:
+            return None
+        upper_known = self.upper_exclusive and self.analysis.is_shape_expression(self.upper, base.entry, dim)
+        if self.lower_known and upper_known and not self.narrowed_bounds:
+            return True
+
+        # The guard needs the bounds again after the loop evaluated them.
+        if not self.lower_known and not self.lower.is_simple():
+            return None
+        if not upper_known and not self.upper.is_simple():
+            return None
+        if not all(bound.is_simple() for bound in self.narrowed_bounds):
+            return None
+        node = self.node
+        if self.narrowed_bounds:
+            node.index_guard_bounds_fit = True
+        if not self.lower_known:
+            node.index_guard_lower = True
+        if not upper_known:
+            if not any(guard_base.entry is base.entry and guard_dim == dim
+                       for guard_base, guard_dim in node.index_guard_shapes):
+                node.index_guard_shapes = list(node.index_guard_shapes) + [(base, dim)]
+        return node
+
+
+class MemoryViewAccessHoisting(Visitor.CythonTransform):
+    """
+    Lets range() loops calculate the parts of the memoryview addressing in their
+    body that do not change between iterations, e.g. the row address
+    "out.data + i * out.strides[0]" and the stride "out.strides[1]" of
+    "out[i, j]" inside of "for j in range(m):".
+
+    This requires that the loop does not modify the memoryview and the leading
+    indices, so they must be local variables that are not used by closures and
+    whose address is not taken anywhere in the function (or integer literals).
+    Only memoryviews with direct access in all dimensions qualify.
+    """
+    # [(ForFromStatNode, entries that it assigns to, {key: HoistedSliceAccess})]
+    loops = None
+    # entries of the current function that pointers or C++ references may modify
+    escaped_entries = frozenset()
+
+    def visit_ModuleNode(self, node):
+        self.loops = []
+        self.visitchildren(node)
+        return node
+
+    def visit_FuncDefNode(self, node):
+        outer_loops, outer_escaped_entries = self.loops, self.escaped_entries
+        self.loops = []
+        self.escaped_entries = _collect_assigned_entries(node.body).escaped_entries
+        self.visitchildren(node)
+        self.loops, self.escaped_entries = outer_loops, outer_escaped_entries
+        return node
+
+    def visit_ForFromStatNode(self, node):
+        if not node.from_range:
+            self.visitchildren(node)
+            return node
+
+        self.visitchildren(node, exclude=('body',))
+        assigned_entries = _collect_assigned_entries(node.target, node.bound1, node.step, node.body).assigned_entries
+        if node.target.is_name:
+            assigned_entries.add(node.target.entry)
+        assigned_entries.update(self.escaped_entries)
+        self.loops.append((node, assigned_entries, {}))
+        self.visitchildren(node, attrs=('body',))
+        self.loops.pop()
+        return node
+
+    def visit_ParallelStatNode(self, node):
+        if self.current_directives['parallel_backend'] != 'threads' and not node.element_reductions:
+            self.visitchildren(node)
+            return node
+        # The thread pool backend moves the section into a separate C function,
+        # which cannot use the addresses that the enclosing loops hoist.
+        # Element reductions replace their variables by per-thread copies.
+        outer_loops, self.loops = self.loops, []
+        self.visitchildren(node)
+        self.loops = outer_loops
+        return node
+
+    def visit_MemoryViewIndexNode(self, node):
+        self.visitchildren(node)
+        if not (self.loops and node.is_memview_index):
+            return node
+        base = node.base
+        if base.is_nonecheck:
+            base = base.arg
+        loop, assigned_entries, hoisted_accesses = self.loops[-1]
+        if not (base.is_name and _is_private_local(base.entry)) or base.entry in assigned_entries:
+            return node
+        if any(MemoryView.get_memoryview_flag(access, packing) not in ('strided', 'contiguous')
+               for access, packing in base.type.axes):
+            return node
+
+        indices = []
+        for index in node.indices:
+            if index.is_name:
+                if not (index.type.is_int and _is_private_local(index.entry)) or index.entry in assigned_entries:
+                    break
+            elif not (index.is_literal and isinstance(index.constant_result, int) and index.constant_result >= 0):
+                break
+            indices.append(index)
+
+        # Indices that LoopIndexBoundsAnalysis found to be in bounds cannot be negative.
+        wraparound = tuple(
+            bool(self.current_directives['wraparound']) and index.is_name and index.type.signed
+            and not (node.index_bounds and node.index_bounds[dim] is True)
+            for dim, index in enumerate(indices))
+        key = (base.entry, wraparound, tuple(
+            index.entry if index.is_name else index.constant_result for index in indices))
+        hoisted_access = hoisted_accesses.get(key)
+        if hoisted_access is None:
+            hoisted_access = hoisted_accesses[key] = MemoryView.HoistedSliceAccess(base, indices, wraparound)
+            loop.hoisted_accesses = list(loop.hoisted_accesses) + [hoisted_access]
+        node.hoisted_access = hoisted_access
+        return node
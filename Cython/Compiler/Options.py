@@ -170,7 +170,7 @@ def copy_inherited_directives(outer_directives, **new_directives):
     #  otherwise they can produce very misleading test failures
     new_directives_out = dict(outer_directives)
     for name in ('test_assert_path_exists', 'test_fail_if_path_exists', 'test_assert_c_code_has', 'test_fail_if_c_code_has',
-                 'test_body_needs_exception_handling', 'critical_section'):
+                 'test_body_needs_exception_handling', 'critical_section', 'fused_specializations'):
         new_directives_out.pop(name, None)
     new_directives_out.update(new_directives)
     return new_directives_out
@@ -194,6 +194,10 @@ _directive_defaults = {
     'initializedcheck' : True,
     'freethreading_compatible': False,
     'subinterpreters_compatible': 'no',
+    'parallel_backend': 'openmp',
+    'borrowed_slices': False,
+    'fused_specializations': [],
+    'show_fused_specializations': False,
     'embedsignature': False,
     'embedsignature.format': 'c',
     'auto_cpdef': False,
@@ -258,6 +262,7 @@ _directive_defaults = {
     'optimize.unpack_method_calls': True,  # increases code size when True
     'optimize.unpack_method_calls_in_pyinit': False,  # uselessly increases code size when True
     'optimize.use_switch': True,
+    'optimize.cache_attribute_lookups': False,  # increases code size when True
 
 # remove unreachable code
     'remove_unreachable': True,
@@ -381,6 +386,7 @@ directive_types = {
     'dataclasses.field': DEFER_ANALYSIS_OF_ARGUMENTS,
     'embedsignature.format': one_of('c', 'clinic', 'python'),
     'subinterpreters_compatible': one_of('no', 'shared_gil', 'own_gil'),
+    'parallel_backend': one_of('openmp', 'threads'),
     'test_body_needs_exception_handling': bool,
 }
 
@@ -444,6 +450,8 @@ directive_scopes = {  # defaults to available everywhere
     'control_flow.dot_annotate_defs': ('module',),
     'freethreading_compatible': ('module',),
     'subinterpreters_compatible': ('module',),
+    'parallel_backend': ('module', 'function'),
+    'fused_specializations': ('function',),
 }
 
 
@@ -456,6 +464,7 @@ immediate_decorator_directives = {
     # class directives
     'freelist', 'no_gc', 'no_gc_clear', 'type_version_tag', 'final',
     'auto_pickle', 'internal', 'collection_type', 'total_ordering',
+    'fused_specializations',
     # testing directives
     'test_fail_if_path_exists', 'test_assert_path_exists',
     'test_body_needs_exception_handling',
@@ -734,7 +743,7 @@ class CompilationOptions:
             elif key in ['timestamps']:
                 # the cache cares about the content of files, not about the timestamps of sources
                 continue
-            elif key in ['cache']:
+            elif key in ['cache', 'cache_sharded']:
                 # hopefully caching has no influence on the compilation result
                 continue
             elif key in ['compiler_directives']:
@@ -773,7 +782,7 @@ class CompilationOptions:
             elif key in ['cplus', 'language_level', 'compile_time_env', 'np_pythran']:
                 # assorted bits that, e.g., influence the parser
                 data[key] = value
-            elif key in ['capi_reexport_cincludes', 'common_utility_include_dir']:
+            elif key in ['capi_reexport_cincludes', 'common_utility_include_dir', 'split_output']:
                 if value:
                     # our caching implementation does not yet include fingerprints of all the header files
                     raise NotImplementedError(f'{key} is not compatible with Cython caching')
@@ -827,9 +836,11 @@ default_options = dict(
     compile_time_env=None,
     module_name=None,
     common_utility_include_dir=None,
+    split_output=0,
     output_dir=None,
     build_dir=None,
     cache=None,
+    cache_sharded=False,
     create_extension=None,
     np_pythran=False,
     legacy_implicit_noexcept=None,
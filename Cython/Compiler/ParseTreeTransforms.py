@@ -1357,11 +1357,11 @@ class InterpretCompilerDirectives(CythonTransform):
         for name, value in directives.items():
             if name == 'locals':
                 node.directive_locals = value
-            elif name not in ('final', 'staticmethod'):
+            elif name not in ('final', 'staticmethod', 'fused_specializations'):
                 self.context.nonfatal_error(PostParseError(
                     node.pos,
                     "Cdef functions can only take cython.locals(), "
-                    "staticmethod, or final decorators, got %s." % name))
+                    "staticmethod, fused_specializations, or final decorators, got %s." % name))
         return self.visit_with_directives(node, directives, contents_directives=None)
 
     def visit_CClassDefNode(self, node):
@@ -4806,3 +4806,60 @@ class HasNoExceptionHandlingVisitor(TreeVisitor):
 
     def visit_CoerceToTempNode(self, node):
         self.visitchildren(node)
+
+
+class ParallelElementReductionCollector(TreeVisitor):
+    """
+    Used by ParallelRangeNode to find the in-place operations on items of
+    memoryviews and C arrays and on fields of C structs in the body of a
+    prange() loop with 'element_reduction', and any other uses of these
+    variables in the body.
+
+    reductions    [(InPlaceAssignmentNode, NameNode, field name or None)]
+    names         [NameNode]   all other names in the body
+    """
+    def __init__(self):
+        super().__init__()
+        self.reductions = []
+        self.names = []
+        self.reduction_names = set()
+
+    def __call__(self, node):
+        self.visit(node)
+        return self
+
+    def target_variable(self, lhs):
+        if lhs.is_memview_index:
+            if lhs.base.is_name and lhs.base.type.is_memoryviewslice:
+                return lhs.base, None
+        elif lhs.is_attribute:
+            obj = lhs.obj
+            if obj.is_name and obj.type.is_struct_or_union and obj.type.kind == 'struct':
+                return obj, lhs.attribute
+        elif lhs.is_subscript:
+            base = lhs
+            while base.is_subscript and base.base.type.is_array:
+                base = base.base
+            if base is not lhs and base.is_name:
+                return base, None
+        return None, None
+
+    def visit_Node(self, node):
+        self.visitchildren(node)
+
+    def visit_InPlaceAssignmentNode(self, node):
+        name, field = self.target_variable(node.lhs)
+        if name is not None:
+            self.reductions.append((node, name, field))
+            self.reduction_names.add(name)
+        self.visitchildren(node)
+
+    def visit_AttributeNode(self, node):
+        if node.attribute == 'shape' and node.obj.is_name and node.obj.type.is_memoryviewslice:
+            # The threads use copies with the same shape.
+            return
+        self.visitchildren(node)
+
+    def visit_NameNode(self, node):
+        if node not in self.reduction_names:
+            self.names.append(node)
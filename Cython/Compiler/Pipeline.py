@@ -171,7 +171,7 @@ def create_pipeline(context, mode, exclude_classes=()):
     from .Optimize import InlineDefNodeCalls
     from .Optimize import ConstantFolding, FinalOptimizePhase
     from .Optimize import DropRefcountingTransform
-    from .Optimize import ConsolidateOverflowCheck
+    from .Optimize import ConsolidateOverflowCheck, LoopIndexBoundsAnalysis, MemoryViewAccessHoisting
     from .Buffer import IntroduceBufferAuxiliaryVars
     from .ModuleNode import check_c_declarations, check_c_declarations_pxd
 
@@ -231,7 +231,9 @@ def create_pipeline(context, mode, exclude_classes=()):
         CreateClosureClasses(context),  ## After all lookups and type inference
         CalculateQualifiedNamesTransform(context),
         ConsolidateOverflowCheck(context),
-        DropRefcountingTransform(),
+        LoopIndexBoundsAnalysis(context),
+        MemoryViewAccessHoisting(context),
+        DropRefcountingTransform(context),
         FinalOptimizePhase(context),
         CoerceCppTemps(context),
         GilCheck(),
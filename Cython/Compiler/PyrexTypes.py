@@ -214,6 +214,7 @@ class PyrexType(BaseType):
     #  is_pymemoryview_type  boolean     Is a Python memoryview type
     #  is_memoryviewslice    boolean     Is a Cython memoryview slice type
     #  is_pythran_expr       boolean     Is Pythran expr
+    #  is_memoryview_expression  boolean  Is element-wise arithmetic on memoryview slices
     #  is_numpy_buffer       boolean     Is Numpy array buffer
     #  is_unowned_view       boolean     Is a pointer or a C++ class such as std::string_view
     #  is_cython_lock_type   boolean     Is a Cython lock
@@ -316,6 +317,7 @@ class PyrexType(BaseType):
 
     is_memoryviewslice = 0
     is_pythran_expr = 0
+    is_memoryview_expression = 0
     is_numpy_buffer = 0
     is_unowned_view = False
     is_cython_lock_type = False
@@ -2299,6 +2301,38 @@ class PythranExpr(CType):
         return hash(self.pythran_type)
 
 
+class MemoryViewExpressionType(PyrexType):
+    # Element-wise arithmetic on memoryview slices, e.g. "a * x + b",
+    # see ExprNodes.ElementwiseMemoryViewNode.  Expressions of this type
+    # have no value of their own and cannot be stored in variables.
+    #
+    #  dtype    CType    the element type
+    #  ndim     int      the number of dimensions
+
+    is_memoryview_expression = True
+
+    def __init__(self, dtype, ndim):
+        self.dtype = dtype
+        self.ndim = ndim
+
+    def __str__(self):
+        return "memoryview expression %s[%s]" % (self.dtype, ", ".join([":"] * self.ndim))
+
+    def declaration_code(self, entity_code,
+                         for_display=0, dll_linkage=None, pyrex=0):
+        return "<memoryview expression>"
+
+    def __eq__(self, other):
+        return (isinstance(other, MemoryViewExpressionType)
+                and self.dtype == other.dtype and self.ndim == other.ndim)
+
+    def __ne__(self, other):
+        return not self == other
+
+    def __hash__(self):
+        return hash((self.dtype, self.ndim))
+
+
 class CQualifierType(BaseType):
     """A C qualifier type - currently const, restrict and volatile"""
 
@@ -3603,9 +3637,12 @@ class CFuncType(CType):
     #  is_const_method  boolean
     #  is_static_method boolean
     #  op_arg_struct    CPtrType   Pointer to optional argument struct
+    #  fused_specializations [string]  signatures allowed by the 'fused_specializations'
+    #                                  directive (all if empty)
 
     is_cfunction = 1
     cached_specialized_types = None
+    fused_specializations = ()
     from_fused = False
     is_const_method = False
     op_arg_struct = None
@@ -3992,14 +4029,17 @@ class CFuncType(CType):
 
         It returns an iterable of two-tuples of the cname that should prefix
         the cname of the function, and a dict mapping any fused types to their
-        respective specific types.
+        respective specific types.  Permutations that were not selected by the
+        'fused_specializations' directive or that duplicate another one are left out.
         """
         assert self.is_fused
 
         if fused_types is None:
             fused_types = self.get_fused_types()
 
-        return get_all_specialized_permutations(fused_types)
+        permutations, _, _ = select_specialized_permutations(
+            fused_types, get_all_specialized_permutations(fused_types), self.fused_specializations)
+        return permutations
 
     def get_all_specialized_function_types(self):
         """
@@ -4240,6 +4280,58 @@ def _get_all_specialized_permutations(fused_types, id="", f2s=()):
 
     return result
 
+def get_permutation_signature(fused_types, fused_to_specific):
+    """
+    Return the signature string of a permutation, as used as key in __signatures__.
+    """
+    return '|'.join([fused_to_specific[fused_type].typeof_name() for fused_type in fused_types])
+
+def select_specialized_permutations(fused_types, permutations, signatures=()):
+    """
+    Restrict the permutations to the given signatures (all if empty) and
+    merge permutations that only differ by non-external ctypedefs of the same
+    type, since they would generate identical C code.
+
+    Returns the selected permutations, a list of two-tuples (merged signature,
+    selected signature) and the list of unknown signatures.
+    """
+    fused_types = unique(fused_types)
+    all_signatures = [get_permutation_signature(fused_types, f2s) for _, f2s in permutations]
+
+    unknown = []
+    if signatures:
+        wanted = set()
+        for signature in signatures:
+            signature = '|'.join([name.strip() for name in signature.split('|')])
+            if signature in all_signatures:
+                wanted.add(signature)
+            else:
+                unknown.append(signature)
+        candidates = [
+            (permutation, signature)
+            for permutation, signature in zip(permutations, all_signatures)
+            if signature in wanted
+        ]
+    else:
+        candidates = list(zip(permutations, all_signatures))
+
+    selected = []
+    merged = []
+    seen = {}
+    for permutation, signature in candidates:
+        f2s = permutation[1]
+        key = tuple([
+            id(specific_type.resolve_known_type() if specific_type.is_typedef else specific_type)
+            for specific_type in [f2s[fused_type] for fused_type in fused_types]
+        ])
+        if key in seen:
+            merged.append((signature, seen[key]))
+        else:
+            seen[key] = signature
+            selected.append(permutation)
+
+    return selected, merged, unknown
+
 def specialization_signature_string(fused_compound_type, fused_to_specific):
     """
     Return the signature for a specialization of a fused type. e.g.
@@ -6,7 +6,7 @@
 
 import cython
 
-cython.declare(make_lexicon=object, lexicon=object,
+cython.declare(make_lexicon=object, load_lexicon_tables=object, lexicon=object,
                print_function=object, error=object, warning=object,
                os=object, platform=object, Path=object)
 
@@ -20,7 +20,7 @@ from .. import Utils
 from ..Plex.Errors import UnrecognizedInput
 from ..Plex.Scanners import Scanner
 from .Errors import error, warning, hold_errors, release_errors, CompileError
-from .Lexicon import any_string_prefix, ft_string_prefixes, make_lexicon, IDENT
+from .Lexicon import any_string_prefix, ft_string_prefixes, make_lexicon, load_lexicon_tables, IDENT
 from .Future import print_function
 from .Lexicon import IDENT, any_string_prefix, make_lexicon
 
@@ -35,7 +35,7 @@ lexicon = None
 def get_lexicon():
     global lexicon
     if not lexicon:
-        lexicon = make_lexicon()
+        lexicon = make_lexicon(load_lexicon_tables())
     return lexicon
 
 
@@ -0,0 +1,259 @@
+#
+#   Cython - Compiler Server
+#
+#   A long-running process that keeps the compiler imported and its
+#   static tables (scanner, utility code) loaded, and a thin client that
+#   forwards "cython" command lines to it over a Unix domain socket.
+#
+#   Usage:
+#       python -m Cython.Compiler.Server --serve SOCKET_PATH
+#       python -m Cython.Compiler.Server --connect SOCKET_PATH [cython options] sources...
+#
+#   The "cython" command forwards its command line to a running server
+#   if the environment variable CYTHON_SERVER names its socket.
+#
+#   Each request is compiled in a child process that is forked from the
+#   warmed-up server, so that global compiler state (e.g. the Options set
+#   by the command line) never leaks between compilations.  The client's
+#   stdout and stderr are passed to the child, which writes to them directly.
+#
+#   This module must stay cheap to import, since the client uses it.
+#
+
+import json
+import os
+import socket
+import struct
+import sys
+
+# Do not forward variables that differ between clients and do not influence compilation.
+_ENV_PREFIXES = ("CYTHON_", "PYTHON", "CFLAGS", "LANG", "LC_")
+
+
+def _send_message(sock, data, fds=()):
+    payload = json.dumps(data).encode('utf-8')
+    message = struct.pack('!I', len(payload)) + payload
+    if fds:
+        socket.send_fds(sock, [message], list(fds))
+    else:
+        sock.sendall(message)
+
+
+def _recv_exactly(sock, size, received=b''):
+    while len(received) < size:
+        chunk = sock.recv(size - len(received))
+        if not chunk:
+            raise ConnectionError("Cython server connection closed unexpectedly")
+        received += chunk
+    return received
+
+
+def _recv_message(sock, with_fds=False):
+    fds = []
+    if with_fds:
+        # The file descriptors arrive with the first chunk of the message.
+        data, fds, _, _ = socket.recv_fds(sock, 65536, 3)
+    else:
+        data = b''
+    data = _recv_exactly(sock, 4, data)
+    size, = struct.unpack('!I', data[:4])
+    data = _recv_exactly(sock, size + 4, data)
+    return json.loads(data[4:].decode('utf-8')), fds
+
+
+# ------------------------------------------------------------------------
+#
+#  Client
+#
+# ------------------------------------------------------------------------
+
+def run_client(socket_path, args):
+    """
+    Let the server at 'socket_path' compile the command line 'args'.
+    Returns the exit code of the compilation, or None if the server is not reachable.
+    """
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    try:
+        sock.connect(socket_path)
+    except OSError:
+        sock.close()
+        return None
+
+    with sock:
+        request = {
+            'argv': [sys.argv[0]] + list(args),
+            'cwd': os.getcwd(),
+            'env': {
+                name: value for name, value in os.environ.items()
+                if name.startswith(_ENV_PREFIXES)
+            },
+        }
+        sys.stdout.flush()
+        sys.stderr.flush()
+        _send_message(sock, request, fds=(_fileno(sys.stdout, 1), _fileno(sys.stderr, 2)))
+        response, _ = _recv_message(sock)
+    return response['exit_code']
+
+
+def _fileno(stream, default):
+    try:
+        return stream.fileno()
+    except (AttributeError, OSError, ValueError):
+        # Replaced stream without a file descriptor, use the process's one.
+        return default
+
+
+def client_main(socket_path, args):
+    exit_code = run_client(socket_path, args)
+    if exit_code is None:
+        # No server running, compile locally.
+        from .Main import main
+        sys.argv[1:] = args
+        main(command_line=1)
+        exit_code = 0
+    sys.exit(exit_code)
+
+
+# ------------------------------------------------------------------------
+#
+#  Server
+#
+# ------------------------------------------------------------------------
+
+def warm_up():
+    """
+    Import the compiler and load the static data that each compilation needs,
+    so that forked compilations start with it in place.
+    """
+    from . import Main, Pipeline, ParseTreeTransforms, ModuleNode, Optimize, Scanning
+    from .Code import UtilityCode
+    Scanning.get_lexicon()
+
+    utility_dir = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'Utility')
+    for filename in sorted(os.listdir(utility_dir)):
+        if os.path.splitext(filename)[1] in ('.c', '.cpp', '.h', '.pyx', '.pxd'):
+            try:
+                UtilityCode.load_utilities_from_file(filename)
+            except ValueError:
+                pass  # not a utility code file (e.g. a plain header file)
+
+
+def _peer_uid(conn):
+    """
+    Return the user id of the process at the other end of 'conn',
+    or None if the platform does not tell.
+    """
+    if not hasattr(socket, 'SO_PEERCRED'):
+        return None
+    credentials = conn.getsockopt(socket.SOL_SOCKET, socket.SO_PEERCRED, struct.calcsize('3i'))
+    pid, uid, gid = struct.unpack('3i', credentials)
+    return uid
+
+
+def _compile_request(conn):
+    """
+    Handle a single compile request in a forked child process.  Does not return.
+    """
+    exit_code = 1
+    try:
+        # The compilation runs with the rights of the server, so only serve its own user.
+        peer_uid = _peer_uid(conn)
+        if peer_uid is not None and peer_uid != os.getuid():
+            return
+        request, fds = _recv_message(conn, with_fds=True)
+        os.dup2(fds[0], 1)
+        os.dup2(fds[1], 2)
+        for fd in fds:
+            os.close(fd)
+
+        os.chdir(request['cwd'])
+        os.environ.update(request['env'])
+        sys.argv = request['argv']
+
+        from .Main import main
+        try:
+            main(command_line=1)
+            exit_code = 0
+        except SystemExit as exc:
+            code = exc.code
+            exit_code = code if isinstance(code, int) else (0 if code is None else 1)
+        except BaseException:
+            import traceback
+            traceback.print_exc()
+    finally:
+        try:
+            sys.stdout.flush()
+            sys.stderr.flush()
+            _send_message(conn, {'exit_code': exit_code})
+        finally:
+            os._exit(0)
+
+
+def _is_server_running(socket_path):
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    try:
+        sock.connect(socket_path)
+    except OSError:
+        return False
+    finally:
+        sock.close()
+    return True
+
+
+def serve(socket_path, quiet=False):
+    import signal
+
+    warm_up()
+
+    if os.path.exists(socket_path):
+        # Remove a stale socket, but refuse to run next to a live server.
+        if _is_server_running(socket_path):
+            raise RuntimeError(f"A Cython server is already listening on '{socket_path}'")
+        os.unlink(socket_path)
+
+    # Let the kernel reap the compilation processes.
+    signal.signal(signal.SIGCHLD, signal.SIG_IGN)
+    # Clean up the socket file when being terminated.
+    signal.signal(signal.SIGTERM, lambda *args: sys.exit(0))
+
+    server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    server.bind(socket_path)
+    # Nobody can connect before listen(), so restricting the socket here leaves no gap.
+    os.chmod(socket_path, 0o600)
+    server.listen(64)
+    if not quiet:
+        print(f"Cython server listening on '{socket_path}'", flush=True)
+    try:
+        while True:
+            conn, _ = server.accept()
+            if os.fork() == 0:
+                server.close()
+                _compile_request(conn)
+            conn.close()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.close()
+        try:
+            os.unlink(socket_path)
+        except FileNotFoundError:
+            pass
+
+
+def main(args=None):
+    if args is None:
+        args = sys.argv[1:]
+    usage = (
+        "usage: python -m Cython.Compiler.Server --serve SOCKET_PATH\n"
+        "       python -m Cython.Compiler.Server --connect SOCKET_PATH [cython options] sources...\n")
+    if len(args) < 2 or args[0] not in ('--serve', '--connect'):
+        sys.stderr.write(usage)
+        sys.exit(2)
+    if args[0] == '--serve':
+        serve(args[1])
+    else:
+        client_main(args[1], args[2:])
+
+
+if __name__ == '__main__':
+    main()
@@ -1,8 +1,10 @@
 import unittest
 from io import StringIO
 import string
+import textwrap
 
 from .. import Scanning
+from ..Lexicon import make_lexicon
 from ..Symtab import ModuleScope
 from ...TestUtils import TimedTest
 from ..TreeFragment import StringParseContext
@@ -125,7 +127,47 @@ class TestScanning(TimedTest):
             scanner.error("Oooops")
         self.assertEqual((scanner.sy, scanner.systring), (sy1, systring1))
 
-
+    def scan_tokens(self, lexicon, code):
+        source = Scanning.StringSourceDescriptor("fake code", code)
+        context = StringParseContext("fake context")
+        scope = ModuleScope("fake_module", None, None)
+        old_lexicon = Scanning.lexicon
+        Scanning.lexicon = lexicon
+        try:
+            scanner = Scanning.PyrexScanner(StringIO(code), source, scope=scope, context=context)
+        finally:
+            Scanning.lexicon = old_lexicon
+        tokens = []
+        while scanner.sy != "EOF":
+            tokens.append((scanner.sy, scanner.systring, scanner.position()[1:]))
+            scanner.next()
+        return tokens
+
+    def test_lexicon_tables(self):
+        dfa_lexicon = make_lexicon()
+        tables = dfa_lexicon.serialize_tables()
+        table_lexicon = make_lexicon(tables)
+        self.assertIsNone(table_lexicon.machine)
+        self.assertIsNotNone(table_lexicon.tables)
+        self.assertEqual(tables, table_lexicon.serialize_tables())
+
+        code = textwrap.dedent(r"""
+            def f(a, *args, b=0x1_F, **kwargs) -> int:
+                '''docstring with \x41 and \N{DASH}'''
+                s = r'raw\w' + b"bytes\n" + u'''triple
+            quoted'''
+                t = f"{a!r:>{b}} {{}}" + rf'{s}\d' + t"{args}"
+                größe = 1.5e-3j + 0o17 + 0b1_0 + 10L
+                if a <= b and a != b or not a: pass  # comment
+                return [x ** 2 for x in (a, b)] @ {'k': ...}
+            """)
+        tokens = self.scan_tokens(table_lexicon, code)
+        self.assertIn(("IDENT", "größe", (7, 4)), tokens)
+        self.assertEqual(self.scan_tokens(dfa_lexicon, code), tokens)
+
+        # Tables for a different specification are ignored.
+        stale_tables = ("0" * len(tables[0]),) + tables[1:]
+        self.assertIsNone(make_lexicon(stale_tables).tables)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,91 @@
+import os
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+import unittest
+
+from ..Server import run_client
+from ...TestUtils import TimedTest
+
+
+@unittest.skipUnless(hasattr(os, 'fork') and hasattr(socket, 'AF_UNIX'), "requires fork() and Unix domain sockets")
+class TestCompilerServer(TimedTest):
+    def setUp(self):
+        super().setUp()
+        self._tmpdir = tempfile.TemporaryDirectory()
+        self.temp_path = self._tmpdir.name
+        self.socket_path = os.path.join(self.temp_path, "cython.sock")
+        env = dict(os.environ)
+        cython_root = os.path.dirname(os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__)))))
+        env['PYTHONPATH'] = os.pathsep.join(filter(None, [cython_root, env.get('PYTHONPATH')]))
+        self.server = subprocess.Popen(
+            [sys.executable, "-m", "Cython.Compiler.Server", "--serve", self.socket_path],
+            stdout=subprocess.DEVNULL, env=env)
+        for _ in range(600):
+            if os.path.exists(self.socket_path):
+                break
+            time.sleep(0.05)
+        else:
+            self.fail("Cython server did not start")
+
+    def tearDown(self):
+        self.server.terminate()
+        self.server.wait()
+        self._tmpdir.cleanup()
+        super().tearDown()
+
+    def write_file(self, filename, code):
+        path = os.path.join(self.temp_path, filename)
+        with open(path, "w") as f:
+            f.write(code)
+        return path
+
+    def test_compile(self):
+        source = self.write_file("server_ok.pyx", "def f(x): return x + 1\n")
+        self.assertEqual(0, run_client(self.socket_path, [source]))
+        self.assertTrue(os.path.exists(source[:-4] + ".c"))
+
+        # Options of one request must not leak into the next one.
+        self.assertEqual(0, run_client(self.socket_path, ["-+", source]))
+        self.assertTrue(os.path.exists(source[:-4] + ".cpp"))
+        os.unlink(source[:-4] + ".c")
+        self.assertEqual(0, run_client(self.socket_path, [source]))
+        self.assertTrue(os.path.exists(source[:-4] + ".c"))
+
+    def test_compile_error(self):
+        source = self.write_file("server_error.pyx", "x = \n")
+        with open(os.devnull, "w") as devnull:
+            stderr = sys.stderr
+            sys.stderr = devnull
+            try:
+                self.assertEqual(1, run_client(self.socket_path, [source]))
+            finally:
+                sys.stderr = stderr
+        self.assertFalse(os.path.exists(source[:-4] + ".c"))
+
+    def test_no_server(self):
+        self.assertIsNone(run_client(os.path.join(self.temp_path, "missing.sock"), ["x.pyx"]))
+
+    def test_socket_permissions(self):
+        self.assertEqual(0o600, os.stat(self.socket_path).st_mode & 0o777)
+
+    @unittest.skipUnless(hasattr(socket, 'SO_PEERCRED') and os.getuid() == 0,
+                         "requires SO_PEERCRED and root to switch the user")
+    def test_reject_other_user(self):
+        source = self.write_file("server_other_user.pyx", "def f(x): return x + 1\n")
+        # Open up the directory and the socket to see that the server itself rejects the request.
+        os.chmod(self.temp_path, 0o777)
+        os.chmod(self.socket_path, 0o666)
+        pid = os.fork()
+        if pid == 0:
+            exit_code = 2
+            try:
+                os.setuid(65534)
+                exit_code = run_client(self.socket_path, [source])
+            finally:
+                os._exit(3 if exit_code is None else exit_code)
+        _, status = os.waitpid(pid, 0)
+        self.assertEqual(1, os.waitstatus_to_exitcode(status))
+        self.assertFalse(os.path.exists(source[:-4] + ".c"))
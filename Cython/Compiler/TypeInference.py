@@ -203,6 +203,7 @@ class MarkParallelAssignments(EnvTransform):
     def visit_ParallelStatNode(self, node):
         if self.parallel_block_stack:
             node.parent = self.parallel_block_stack[-1]
+            node.parent.has_nested_section = True
         else:
             node.parent = None
 
@@ -248,6 +249,8 @@ class MarkParallelAssignments(EnvTransform):
 
     def visit_ReturnStatNode(self, node):
         node.in_parallel = bool(self.parallel_block_stack)
+        if node.in_parallel:
+            self.parallel_block_stack[0].has_return = True
         return node
 
     def visit_ExprNode(self, node):
@@ -540,6 +543,9 @@ def simply_type(result_type):
     result_type = PyrexTypes.remove_cv_ref(result_type, remove_fakeref=True)
     if result_type.is_array:
         result_type = PyrexTypes.c_ptr_type(result_type.base_type)
+    elif result_type.is_memoryview_expression:
+        # cannot be stored, only assigned to slices or reduced
+        result_type = py_object_type
     return result_type
 
 def aggressive_spanning_type(types, might_overflow, scope):
@@ -270,7 +270,8 @@ class CythonUtilityCode(Code.UtilityCodeBase):
             'auto_pickle', 'ccomplex',
             'c_string_type', 'c_string_encoding',
             'optimize.inline_defnode_calls', 'optimize.unpack_method_calls',
-            'optimize.unpack_method_calls_in_pyinit', 'optimize.use_switch')
+            'optimize.unpack_method_calls_in_pyinit', 'optimize.use_switch',
+            'optimize.cache_attribute_lookups')
         for name in inherited_directive_names:
             if name in current_directives:
                 utility_code_directives[name] = current_directives[name]
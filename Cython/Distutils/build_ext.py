@@ -1,5 +1,7 @@
 import sys
 import os
+import re
+from contextlib import contextmanager
 
 # Always inherit from the "build_ext" in distutils since setuptools already imports
 # it from Cython if available, and does the proper distutils fallback otherwise.
@@ -47,11 +49,15 @@ class build_ext(_build_ext):
              "generate debug information for cygdb"),
         ('cython-compile-time-env', None,
             "cython compile time environment"),
+        ('cython-split-output=', None,
+            "number of C files to generate for each module"),
+        ('cython-no-pch', None,
+            "do not precompile the module preamble in the common utility include directory"),
         ]
 
     boolean_options = _build_ext.boolean_options + [
         'cython-cplus', 'cython-create-listing', 'cython-line-directives',
-        'cython-c-in-temp', 'cython-gdb',
+        'cython-c-in-temp', 'cython-gdb', 'cython-no-pch',
     ]
 
     def initialize_options(self):
@@ -65,6 +71,8 @@ class build_ext(_build_ext):
         self.cython_gen_pxi = 0
         self.cython_gdb = False
         self.cython_compile_time_env = None
+        self.cython_split_output = None
+        self.cython_no_pch = False
         self.shared_utility_qualified_name = None
         self.shared_utility_features_enabled = None
         self.shared_utility_features_disabled = None
@@ -78,6 +86,8 @@ class build_ext(_build_ext):
                 self.cython_include_dirs.split(os.pathsep)
         if self.cython_directives is None:
             self.cython_directives = {}
+        if self.cython_split_output is not None:
+            self.cython_split_output = int(self.cython_split_output)
 
     def get_extension_attr(self, extension, option_name, default=False):
         return getattr(self, option_name) or getattr(extension, option_name, default)
@@ -130,14 +140,154 @@ class build_ext(_build_ext):
             'shared_utility_qualified_name': self.get_extension_attr(ext, 'shared_utility_qualified_name', default=None),
             'shared_utility_features_enabled': self.get_extension_attr(ext, 'shared_utility_features_enabled', default=None),
             'shared_utility_features_disabled': self.get_extension_attr(ext, 'shared_utility_features_disabled', default=None),
+            'split_output': self.get_extension_attr(ext, 'cython_split_output', default=0) or 0,
         }
 
+        # The shared utility module is a separate extension that cythonize() adds to the
+        # extension list of the setup script, so do not generate it for each module again.
         new_ext = cythonize(
-            ext,force=self.force, quiet=self.verbose == 0, **options
+            ext,force=self.force, quiet=self.verbose == 0, build_shared_utility=False, **options
         )[0]
 
         ext.sources = new_ext.sources
-        super().build_extension(ext)
+        if not self.cython_no_pch:
+            precompile_common_preamble(self.compiler, ext, self.debug)
+        if self.parallel and is_split_module(ext.sources):
+            with compile_sources_in_parallel(self.compiler, self.parallel):
+                super().build_extension(ext)
+        else:
+            super().build_extension(ext)
+
+
+def is_split_module(sources):
+    """
+    Tests if the sources contain a module that was generated with the 'split_output' option.
+    """
+    from Cython.Utils import split_output_files
+    return any(split_output_files(source, 2)[1][0] in sources for source in sources)
+
+
+@contextmanager
+def compile_sources_in_parallel(compiler, parallel):
+    """
+    Makes the (Unix style) compiler build the sources of an extension in parallel
+    while the context is active, for the C files of a split module.
+    """
+    from distutils.ccompiler import CCompiler
+    if getattr(compiler.compile, '__func__', None) is not CCompiler.compile:
+        # A compiler that does not use '_compile()', like MSVC.
+        yield
+        return
+    max_workers = None if parallel is True else parallel
+
+    def compile(sources, output_dir=None, macros=None, include_dirs=None, debug=False,
+                extra_preargs=None, extra_postargs=None, depends=None):
+        # Same as 'CCompiler.compile()', but with a thread pool.
+        macros, objects, extra_postargs, pp_opts, build = compiler._setup_compile(
+            output_dir, macros, include_dirs, sources, depends, extra_postargs)
+        cc_args = compiler._get_cc_args(pp_opts, debug, extra_preargs)
+
+        def compile_object(obj):
+            if obj in build:
+                src, ext = build[obj]
+                compiler._compile(obj, src, ext, cc_args, extra_postargs, pp_opts)
+
+        from concurrent.futures import ThreadPoolExecutor
+        with ThreadPoolExecutor(max_workers) as executor:
+            list(executor.map(compile_object, objects))
+        return objects
+
+    original_compile = vars(compiler).get('compile')
+    compiler.compile = compile
+    try:
+        yield
+    finally:
+        if original_compile is None:
+            del compiler.compile
+        else:
+            compiler.compile = original_compile
+
+_find_common_preamble_include = re.compile(
+    r'^#include "([^"]*/ModulePreamble_[0-9a-f]+\.h)"$', re.MULTILINE).search
+
+_gcc_macros_cache = {}
+
+
+def _get_gcc_macros(compiler_command):
+    # Returns the predefined macros of the compiler if it is GCC, else None.
+    if compiler_command not in _gcc_macros_cache:
+        import subprocess
+        try:
+            macros = subprocess.run(
+                [*compiler_command, '-dM', '-E', '-x', 'c', os.devnull],
+                capture_output=True, text=True, check=True).stdout
+        except (OSError, subprocess.CalledProcessError):
+            macros = None
+        if macros and ('__GNUC__' not in macros or '__clang__' in macros):
+            macros = None
+        _gcc_macros_cache[compiler_command] = macros
+    return _gcc_macros_cache[compiler_command]
+
+
+def precompile_common_preamble(compiler, ext, debug=False):
+    """
+    Modules that were generated with a 'common_utility_include_dir' start with
+    the same preamble header.  GCC looks for precompiled versions of a header
+    in a directory "<header>.gch/" and uses the first one that matches the
+    current compiler options, so we store one file per combination of compiler,
+    Python and C flags in there and build it only once for all modules.
+    """
+    if compiler.compiler_type != 'unix':
+        return
+    headers = set()
+    for source in ext.sources:
+        if os.path.splitext(source)[1] not in ('.c', '.cpp'):
+            continue
+        try:
+            with open(source, encoding='utf-8') as f:
+                # The include follows the "generated by" comment and the module metadata.
+                match = _find_common_preamble_include(f.read(100000))
+        except OSError:
+            continue
+        if match:
+            headers.add(match.group(1))
+    if not headers:
+        return
+
+    compiler_command = tuple(compiler.compiler_so)
+    if compiler_command and os.path.basename(compiler_command[0]) == 'ccache':
+        compiler_command = compiler_command[1:]
+    gcc_macros = _get_gcc_macros(compiler_command)
+    if gcc_macros is None:
+        return
+
+    from distutils.ccompiler import gen_preprocess_options
+    from distutils.errors import DistutilsExecError
+    macros = list(ext.define_macros) + [(name,) for name in ext.undef_macros]
+    _, macros, include_dirs = compiler._fix_compile_args(None, macros, ext.include_dirs)
+    cc_args = compiler._get_cc_args(gen_preprocess_options(macros, include_dirs), debug, None)
+    language = 'c++-header' if ext.language == 'c++' else 'c-header'
+    command = [*compiler_command, *cc_args, *(ext.extra_compile_args or []), '-x', language]
+
+    import hashlib
+    key = hashlib.sha256(repr((command, gcc_macros)).encode('utf-8')).hexdigest()
+    for header in sorted(headers):
+        pch_dir = header + '.gch'
+        pch_file = os.path.join(pch_dir, key + '.gch')
+        if os.path.exists(pch_file):
+            continue
+        os.makedirs(pch_dir, exist_ok=True)
+        tmp_file = f'{pch_file}.tmp{os.getpid()}'
+        try:
+            compiler.spawn([*command, header, '-o', tmp_file])
+            os.replace(tmp_file, pch_file)
+        except (OSError, DistutilsExecError) as exc:
+            # Not fatal, the C compiler simply uses the header itself.
+            print(f"Warning: failed to precompile '{header}': {exc}")
+        finally:
+            if os.path.exists(tmp_file):
+                os.unlink(tmp_file)
+
 
 # backward compatibility
 new_build_ext = build_ext
@@ -35,6 +35,7 @@ class Extension(_Extension.Extension):
                  cython_gdb=False,
                  no_c_in_traceback=False,
                  cython_compile_time_env=None,
+                 cython_split_output=None,
                  **kw):
 
         # Translate pyrex_X to cython_X for backwards compatibility.
@@ -90,6 +91,7 @@ class Extension(_Extension.Extension):
         self.cython_gdb = cython_gdb
         self.no_c_in_traceback = no_c_in_traceback
         self.cython_compile_time_env = cython_compile_time_env
+        self.cython_split_output = cython_split_output
 
 # class Extension
 
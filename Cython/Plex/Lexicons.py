@@ -4,6 +4,8 @@ Python Lexical Analyser
 Lexical Analyser Specification
 """
 
+import hashlib
+
 from . import Actions
 from . import DFA
 from . import Errors
@@ -14,6 +16,9 @@ from . import Regexps
 DUMP_NFA = 1
 DUMP_DFA = 2
 
+# Changes whenever the layout of the serialised state tables changes.
+TABLES_FORMAT = "StateTableMachine 1"
+
 
 class State:
     """
@@ -108,29 +113,50 @@ class Lexicon:
     machine = None  # Machine
     tables = None   # StateTableMachine
 
-    def __init__(self, specifications, debug=None, debug_flags=7):
+    def __init__(self, specifications, debug=None, debug_flags=7, tables=None):
+        """
+        |tables| is optional and may be the result of serialize_tables() of an
+        earlier Lexicon.  If it was built from the same specification, it is
+        used instead of building the DFA from the regular expressions.
+        """
         if not isinstance(specifications, list):
             raise Errors.InvalidScanner("Scanner definition is not a list")
 
-        nfa = Machines.Machine()
-        default_initial_state = nfa.new_initial_state('')
         token_number = 1
-
+        parsed_specifications = []  # [(state name or None, [(pattern, action)])]
         for spec in specifications:
             if isinstance(spec, State):
-                user_initial_state = nfa.new_initial_state(spec.name)
-                for token in spec.tokens:
-                    self.add_token_to_machine(
-                        nfa, user_initial_state, token, token_number)
-                    token_number += 1
+                tokens = [
+                    self.parse_token_definition(token, token_number + i)
+                    for i, token in enumerate(spec.tokens)
+                ]
+                parsed_specifications.append((spec.name, tokens))
             elif isinstance(spec, tuple):
-                self.add_token_to_machine(
-                    nfa, default_initial_state, spec, token_number)
-                token_number += 1
+                parsed_specifications.append((None, [self.parse_token_definition(spec, token_number)]))
             else:
                 raise Errors.InvalidToken(
                     token_number,
                     "Expected a token definition (tuple) or State instance")
+            token_number += len(parsed_specifications[-1][1])
+
+        self.actions = [action for _, tokens in parsed_specifications for _, action in tokens]
+        self.fingerprint = self.calculate_fingerprint(parsed_specifications)
+        if tables is not None and tables[0] == self.fingerprint:
+            self.tables = Machines.StateTableMachine.from_data(tables[1:], self.actions)
+            return
+
+        nfa = Machines.Machine()
+        default_initial_state = nfa.new_initial_state('')
+        token_number = 1
+
+        for state_name, tokens in parsed_specifications:
+            if state_name is None:
+                initial_state = default_initial_state
+            else:
+                initial_state = nfa.new_initial_state(state_name)
+            for pattern, action in tokens:
+                self.add_token_to_machine(nfa, initial_state, pattern, action, token_number)
+                token_number += 1
 
         if debug and (debug_flags & 1):
             debug.write("\n============= NFA ===========\n")
@@ -144,35 +170,60 @@ class Lexicon:
 
         self.machine = dfa
 
-    def add_token_to_machine(self, machine, initial_state, token_spec, token_number):
+    def add_token_to_machine(self, machine, initial_state, pattern, action, token_number):
         try:
-            (re, action_spec) = self.parse_token_definition(token_spec)
-            if isinstance(action_spec, Actions.Action):
-                action = action_spec
-            else:
-                try:
-                    action_spec.__call__
-                except AttributeError:
-                    action = Actions.Return(action_spec)
-                else:
-                    action = Actions.Call(action_spec)
             final_state = machine.new_state()
-            re.build_machine(machine, initial_state, final_state,
-                             match_bol=1, nocase=0)
+            pattern.build_machine(machine, initial_state, final_state,
+                                  match_bol=1, nocase=0)
             final_state.set_action(action, priority=-token_number)
         except Errors.PlexError as e:
             raise e.__class__("Token number %d: %s" % (token_number, e))
 
-    def parse_token_definition(self, token_spec):
+    def parse_token_definition(self, token_spec, token_number):
         if not isinstance(token_spec, tuple):
-            raise Errors.InvalidToken("Token definition is not a tuple")
+            raise Errors.InvalidToken(token_number, "Token definition is not a tuple")
         if len(token_spec) != 2:
-            raise Errors.InvalidToken("Wrong number of items in token definition")
+            raise Errors.InvalidToken(token_number, "Wrong number of items in token definition")
 
-        pattern, action = token_spec
+        pattern, action_spec = token_spec
         if not isinstance(pattern, Regexps.RE):
-            raise Errors.InvalidToken("Pattern is not an RE instance")
+            raise Errors.InvalidToken(token_number, "Pattern is not an RE instance")
+
+        if isinstance(action_spec, Actions.Action):
+            action = action_spec
+        else:
+            try:
+                action_spec.__call__
+            except AttributeError:
+                action = Actions.Return(action_spec)
+            else:
+                action = Actions.Call(action_spec)
         return (pattern, action)
 
+    def calculate_fingerprint(self, parsed_specifications):
+        """
+        Return a hash of the patterns, actions and states of the specification,
+        which identifies the matching serialised tables.
+        """
+        fingerprint = hashlib.sha256(TABLES_FORMAT.encode('utf-8'))
+        for state_name, tokens in parsed_specifications:
+            fingerprint.update(("State(%r)\n" % state_name).encode('utf-8'))
+            for pattern, action in tokens:
+                fingerprint.update(("%s -> %r\n" % (pattern, action)).encode('utf-8'))
+        return fingerprint.hexdigest()
+
+    def serialize_tables(self):
+        """
+        Return the state tables of the DFA as plain Python data (tuples, ints,
+        strings and a dict) that can be passed as |tables| into a new Lexicon
+        with the same specification.
+        """
+        tables = self.tables
+        if tables is None:
+            tables = Machines.StateTableMachine.from_machine(self.machine)
+        return (self.fingerprint,) + tables.serialize(self.actions)
+
     def get_initial_state(self, name):
+        if self.tables is not None:
+            return self.tables.get_initial_state(name)
         return self.machine.get_initial_state(name)
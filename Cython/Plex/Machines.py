@@ -4,6 +4,9 @@ Python Lexical Analyser
 Classes for building NFAs and DFAs
 """
 
+from array import array
+from bisect import bisect_right
+
 import cython
 from .Transitions import TransitionMap
 
@@ -236,3 +239,119 @@ class FastMachine:
             return repr(c1)
         else:
             return f"{c1!r}..{c2!r}"
+
+
+class StateTableMachine:
+    """
+    StateTableMachine is a deterministic machine represented as flat tables
+    of integers, which can be serialised as plain Python data and restored
+    without rebuilding the machine from its regular expressions.
+
+    Characters are mapped to character classes, such that all characters in
+    a class lead to the same state from any state.  The transition table has
+    'num_classes' entries per state, one for each character class and three
+    more for the special events BOL, EOL and EOF, in that order.
+    """
+    def __init__(self, initial_states, state_actions, class_bounds, bound_classes, num_classes, table):
+        self.initial_states = initial_states  # {state_name: state index}
+        self.state_actions = state_actions    # [Action or None] for each state
+        self.class_bounds = class_bounds      # [code] first character code of each range of characters
+        self.bound_classes = bound_classes    # [character class] for each range of characters
+        self.num_classes = num_classes
+        self.table = array('i', table)        # [state index or -1] for each (state, character class)
+        self.latin1_classes = array('i', [self.char_class(code) for code in range(256)])
+
+    @classmethod
+    def from_machine(cls, machine):
+        """
+        Build the tables from a FastMachine.
+        """
+        states = machine.states
+        state_index = {id(state): i for i, state in enumerate(states)}
+
+        # Split the character codes into ranges in which all characters have
+        # the same transition in all states.
+        bounds = {0}
+        for state in states:
+            codes = sorted([ord(c) for c in state if len(c) == 1])
+            previous = None
+            for code in codes:
+                if previous is None or code != previous + 1 or state[chr(code)] is not state[chr(previous)]:
+                    if previous is not None:
+                        bounds.add(previous + 1)
+                    bounds.add(code)
+                previous = code
+            if previous is not None:
+                bounds.add(previous + 1)
+        class_bounds = sorted(bounds)
+
+        # Ranges with the same transitions in all states form a character class.
+        columns = {}
+        bound_classes = []
+        for code in class_bounds:
+            c = chr(code) if code <= 0x10FFFF else None
+            column = []
+            for state in states:
+                new_state = state.get(c) if c is not None else None
+                if new_state is None:
+                    new_state = state['else']
+                column.append(-1 if new_state is None else state_index[id(new_state)])
+            bound_classes.append(columns.setdefault(tuple(column), len(columns)))
+        columns = list(columns)
+        for special in ('bol', 'eol', 'eof'):
+            columns.append([
+                -1 if state[special] is None else state_index[id(state[special])] for state in states])
+
+        table = [column[i] for i in range(len(states)) for column in columns]
+        return cls(
+            {name: state_index[id(state)] for name, state in machine.initial_states.items()},
+            [state['action'] for state in states],
+            class_bounds, bound_classes, len(columns), table)
+
+    @classmethod
+    def from_data(cls, data, actions):
+        """
+        Restore the tables from the result of serialize(), using the same
+        list of Action objects.
+        """
+        initial_states, state_actions, class_bounds, bound_classes, num_classes, table = data
+        return cls(
+            dict(initial_states),
+            [actions[action_index] if action_index >= 0 else None for action_index in state_actions],
+            list(class_bounds), list(bound_classes), num_classes, table)
+
+    def serialize(self, actions):
+        """
+        Return the tables as plain Python data, with each action replaced
+        by its index in the list 'actions'.
+        """
+        action_index = {id(action): i for i, action in enumerate(actions)}
+        return (
+            self.initial_states,
+            tuple([-1 if action is None else action_index[id(action)] for action in self.state_actions]),
+            tuple(self.class_bounds),
+            tuple(self.bound_classes),
+            self.num_classes,
+            tuple(self.table),
+        )
+
+    def char_class(self, code):
+        return self.bound_classes[bisect_right(self.class_bounds, code) - 1]
+
+    def get_initial_state(self, name):
+        return self.initial_states[name]
+
+    def dump(self, file):
+        file.write("Plex.StateTableMachine:\n")
+        file.write("   Initial states:\n")
+        for name, state in sorted(self.initial_states.items()):
+            file.write("      %s: %d\n" % (repr(name), state))
+        num_classes = self.num_classes
+        for state, action in enumerate(self.state_actions):
+            file.write("   State %d:\n" % state)
+            row = self.table[state * num_classes: (state + 1) * num_classes]
+            for char_class, new_state in enumerate(row):
+                if new_state >= 0:
+                    file.write("      class %d --> State %d\n" % (char_class, new_state))
+            if action is not None:
+                file.write("      %s\n" % action)
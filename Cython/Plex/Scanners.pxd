@@ -26,6 +26,12 @@ cdef class Scanner:
     cdef public cur_char
     cdef public long input_state
 
+    # State tables of the lexicon, if it has them.
+    cdef int[:] state_table
+    cdef list state_actions
+    cdef int[:] latin1_classes
+    cdef Py_ssize_t num_classes
+
     cdef public level
 
     @cython.locals(action=Action)
@@ -66,7 +66,7 @@ class Scanner:
     #  last_token_position_tuple = ("", 0, 0)  # tuple of filename, line number and position in line
 
     #  text = None           # text of last token read
-    #  initial_state = None  # Node
+    #  initial_state = None  # Node, or state number if the lexicon has state tables
     #  state_name = ''       # Name of initial state
     #  queue = None          # list of tokens and positions to be returned
     #  trace = 0
@@ -102,6 +102,17 @@ class Scanner:
         self.name = name
         self.queue = []
         self.initial_state = None
+        tables = lexicon.tables
+        if tables is not None:
+            self.state_table = tables.table
+            self.state_actions = tables.state_actions
+            self.latin1_classes = tables.latin1_classes
+            self.num_classes = tables.num_classes
+        else:
+            self.state_table = None
+            self.state_actions = None
+            self.latin1_classes = None
+            self.num_classes = 0
         self.begin('')
         self.next_pos = 0
         self.cur_pos = 0
@@ -168,8 +179,24 @@ class Scanner:
     def run_machine_inlined(self):
         """
         Inlined version of run_machine for speed.
+
+        Runs on the state tables of the lexicon if it has them, otherwise on
+        the dict based states of its DFA.
         """
-        state: dict = self.initial_state
+        state: dict = None
+        state_number: cython.Py_ssize_t = -1
+        new_state_number: cython.Py_ssize_t
+        use_tables: cython.bint = self.state_table is not None
+        state_table: cython.int[:] = self.state_table
+        state_actions: list = self.state_actions
+        latin1_classes: cython.int[:] = self.latin1_classes
+        num_classes: cython.Py_ssize_t = self.num_classes
+        char_class: cython.Py_ssize_t
+        code: cython.long
+        if not use_tables:
+            state = self.initial_state
+        else:
+            state_number = self.initial_state
         cur_pos: cython.Py_ssize_t = self.cur_pos
         cur_line: cython.Py_ssize_t = self.cur_line
         cur_line_start: cython.Py_ssize_t = self.cur_line_start
@@ -190,24 +217,50 @@ class Scanner:
         while 1:
             if trace:
                 print("State %d, %d/%d:%s -->" % (
-                    state['number'], input_state, cur_pos, repr(cur_char)))
+                    state['number'] if not use_tables else state_number,
+                    input_state, cur_pos, repr(cur_char)))
 
             # Begin inlined self.save_for_backup()
-            action = state['action']
+            if not use_tables:
+                action = state['action']
+            else:
+                action = state_actions[state_number]
             if action is not None:
                 b_action, b_cur_pos, b_cur_line, b_cur_line_start, b_cur_char, b_input_state, b_next_pos = \
                     action, cur_pos, cur_line, cur_line_start, cur_char, input_state, next_pos
             # End inlined self.save_for_backup()
 
             c = cur_char
-            new_state = state.get(c, NOT_FOUND)
-            if new_state is NOT_FOUND:
-                new_state = c and state.get('else')
+            if not use_tables:
+                new_state = state.get(c, NOT_FOUND)
+                if new_state is NOT_FOUND:
+                    new_state = c and state.get('else')
+                if new_state:
+                    state = new_state
+            else:
+                # Characters map to a character class, followed by the classes for BOL, EOL and EOF.
+                if len(c) == 1:
+                    code = ord(c)
+                    if code < 256:
+                        char_class = latin1_classes[code]
+                    else:
+                        char_class = self.lexicon.tables.char_class(code)
+                elif c is BOL:
+                    char_class = num_classes - 3
+                elif c is EOL:
+                    char_class = num_classes - 2
+                elif c is EOF:
+                    char_class = num_classes - 1
+                else:
+                    char_class = -1
+                new_state_number = state_table[state_number * num_classes + char_class] if char_class >= 0 else -1
+                new_state = new_state_number >= 0
+                if new_state:
+                    state_number = new_state_number
 
             if new_state:
                 if trace:
-                    print("State %d" % new_state['number'])
-                state = new_state
+                    print("State %d" % (state['number'] if not use_tables else state_number))
                 # Begin inlined: self.next_char()
                 if input_state == 1:
                     cur_pos = next_pos
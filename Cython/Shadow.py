@@ -124,6 +124,9 @@ def test_assert_path_exists(*paths: str) -> _Decorator:
 def test_fail_if_path_exists(*paths: str) -> _Decorator:
     return _empty_decorator
 
+def fused_specializations(*signatures: str) -> _FuncDecorator:
+    return _empty_func_decorator
+
 class _EmptyDecoratorAndManager:
     @overload
     def __call__(self, __val: bool) -> _Decorator: ...
@@ -147,6 +150,9 @@ class _Optimization:
     def unpack_method_calls(val: bool) -> _Decorator:
         return _EmptyDecoratorAndManager()
 
+    def cache_attribute_lookups(val: bool) -> _Decorator:
+        return _EmptyDecoratorAndManager()
+
 cclass = cfunc = ccall = _EmptyDecoratorAndManager()
 
 ufunc = _empty_func_decorator
@@ -160,7 +166,8 @@ annotation_typing = returns = wraparound = boundscheck = initializedcheck = \
     freelist = auto_pickle = cpow = trashcan = auto_cpdef = \
     allow_none_for_extension_args = callspec = show_performance_hints = \
     py2_import = iterable_coroutine = remove_unreachable = \
-    test_body_needs_exception_handling = \
+    test_body_needs_exception_handling = parallel_backend = borrowed_slices = \
+    show_fused_specializations = \
         lambda _: _EmptyDecoratorAndManager()
 
 binding = embedsignature = always_allow_keywords = unraisable_tracebacks = \
@@ -196,7 +203,8 @@ if TYPE_CHECKING:
 
 
 embedsignature.format = overflowcheck.fold = optimize.use_switch = \
-    optimize.unpack_method_calls = lambda arg: _EmptyDecoratorAndManager()
+    optimize.unpack_method_calls = optimize.cache_attribute_lookups = \
+    lambda arg: _EmptyDecoratorAndManager()
 
 final = _empty_decorator
 
@@ -788,7 +796,7 @@ class CythonDotParallel:
     def parallel(self, num_threads=None):
         return nogil
 
-    def prange(self, start=0, stop=None, step=1, nogil=False, schedule=None, chunksize=None, num_threads=None):
+    def prange(self, start=0, stop=None, step=1, nogil=False, schedule=None, chunksize=None, num_threads=None, element_reduction=None):
         if stop is None:
             stop = start
             start = 0
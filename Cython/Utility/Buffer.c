@@ -143,7 +143,7 @@ static int __Pyx__GetBufferAndValidate(
   if (!cast) {
     __Pyx_BufFmt_Context ctx;
     __Pyx_BufFmt_Init(&ctx, stack, dtype);
-    if (!__Pyx_BufFmt_CheckString(&ctx, buf->format)) goto fail;
+    if (!__Pyx_BufFmt_CheckFormat(&ctx, buf->format)) goto fail;
   }
   if (unlikely((size_t)buf->itemsize != dtype->size)) {
     PyErr_Format(PyExc_ValueError,
@@ -175,13 +175,40 @@ fail:;
 //  The alignment code is copied from _struct.c in Python.
 
 static const char* __Pyx_BufFmt_CheckString(__Pyx_BufFmt_Context* ctx, const char* ts);
+static int __Pyx_BufFmt_CheckFormat(__Pyx_BufFmt_Context* ctx, const char* ts);
 static void __Pyx_BufFmt_Init(__Pyx_BufFmt_Context* ctx,
                               __Pyx_BufFmt_StackElem* stack,
                               const __Pyx_TypeInfo* type); /*proto*/
 
+//  Cache of the format strings that were already validated for a dtype,
+//  since the same few formats usually get converted over and over again.
+//  Longer format strings (i.e. larger structs) are not cached.
+
+#define __PYX_BUF_FORMAT_CACHE_SIZE 8
+#define __PYX_BUF_FORMAT_CACHE_MAX_LENGTH 32
+
+typedef struct {
+    const __Pyx_TypeInfo* dtype;
+    char format[__PYX_BUF_FORMAT_CACHE_MAX_LENGTH];
+} __Pyx_BufFmt_CacheEntry;
+
+struct __Pyx_BufFmt_Cache {
+    int next;  /* the entry to replace next */
+    __Pyx_BufFmt_CacheEntry entries[__PYX_BUF_FORMAT_CACHE_SIZE];
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    // 0 for none, +ve for readers, -ve for writers.
+    __pyx_atomic_int_type accessor_count;
+  #endif
+};
+
+/////////////// BufferFormatCheck.module_state_decls ///////////////
+
+struct __Pyx_BufFmt_Cache __pyx_buffer_format_cache;
+
 /////////////// BufferFormatCheck ///////////////
 //@requires: ModuleSetupCode.c::IsLittleEndian
 //@requires: BufferFormatStructs
+//@requires: Synchronization.c::Atomics
 
 static void __Pyx_BufFmt_Init(__Pyx_BufFmt_Context* ctx,
                               __Pyx_BufFmt_StackElem* stack,
@@ -743,6 +770,70 @@ static const char* __Pyx_BufFmt_CheckString(__Pyx_BufFmt_Context* ctx, const cha
   }
 }
 
+static int __Pyx__BufFmt_FindCachedFormat(struct __Pyx_BufFmt_Cache *cache,
+                                          const __Pyx_TypeInfo* dtype, const char* ts) {
+    int i;
+    for (i = 0; i < __PYX_BUF_FORMAT_CACHE_SIZE; i++) {
+        if (cache->entries[i].dtype == dtype && strcmp(cache->entries[i].format, ts) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void __Pyx__BufFmt_InsertCachedFormat(struct __Pyx_BufFmt_Cache *cache,
+                                             const __Pyx_TypeInfo* dtype, const char* ts) {
+    __Pyx_BufFmt_CacheEntry *entry = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % __PYX_BUF_FORMAT_CACHE_SIZE;
+    entry->dtype = dtype;
+    strcpy(entry->format, ts);
+}
+
+// Like __Pyx_BufFmt_CheckString(), but only parses format strings that
+// were not validated for the same dtype before.  Returns 0 on errors.
+static int __Pyx_BufFmt_CheckFormat(__Pyx_BufFmt_Context* ctx, const char* ts) {
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING && !CYTHON_ATOMICS
+    return __Pyx_BufFmt_CheckString(ctx, ts) != NULL;
+#else
+    struct __Pyx_BufFmt_Cache *cache = &CGLOBAL(__pyx_buffer_format_cache);
+    const __Pyx_TypeInfo* dtype = ctx->root.type;
+    int found;
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_nonatomic_int_type expected = 0;
+#endif
+    if (unlikely(!ts) || strlen(ts) >= __PYX_BUF_FORMAT_CACHE_MAX_LENGTH) {
+        return __Pyx_BufFmt_CheckString(ctx, ts) != NULL;
+    }
+
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    if (__pyx_atomic_incr_acq_rel(&cache->accessor_count) < 0) {
+        // It's being written, so just do the full check.
+        __pyx_atomic_decr_acq_rel(&cache->accessor_count);
+        return __Pyx_BufFmt_CheckString(ctx, ts) != NULL;
+    }
+#endif
+    found = __Pyx__BufFmt_FindCachedFormat(cache, dtype, ts);
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_atomic_decr_acq_rel(&cache->accessor_count);
+#endif
+    if (found) return 1;
+
+    if (!__Pyx_BufFmt_CheckString(ctx, ts)) return 0;
+
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    if (!__pyx_atomic_int_cmp_exchange(&cache->accessor_count, &expected, INT_MIN)) {
+        // It's being read or written, so leave it to a later call.
+        return 1;
+    }
+#endif
+    __Pyx__BufFmt_InsertCachedFormat(cache, dtype, ts);
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_atomic_sub(&cache->accessor_count, INT_MIN);
+#endif
+    return 1;
+#endif
+}
+
 /////////////// TypeInfoCompare.proto ///////////////
 static int __pyx_typeinfo_cmp(const __Pyx_TypeInfo *a, const __Pyx_TypeInfo *b);
 
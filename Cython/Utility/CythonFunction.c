@@ -1618,6 +1618,36 @@ if (likely(__pyx_FusedFunction_init($module_cname) == 0)); else
 #endif
 
 
+// Cache of the specialisations that recent calls were dispatched to,
+// keyed on the types (and buffer formats) of the fused arguments.
+#define __PYX_FUSED_DISPATCH_CACHE_SIZE 8
+#define __PYX_FUSED_DISPATCH_MAX_ARGS 4
+#define __PYX_FUSED_DISPATCH_MAX_FORMAT 8
+
+typedef struct {
+    PyTypeObject *type;
+    // for buffer arguments only, ndim is -1 for objects that are not buffers
+    Py_ssize_t itemsize;
+    int ndim;
+    char format[__PYX_FUSED_DISPATCH_MAX_FORMAT];
+} __pyx_FusedDispatchKey;
+
+typedef struct {
+    __pyx_FusedDispatchKey keys[__PYX_FUSED_DISPATCH_MAX_ARGS];  // owns the types
+    Py_ssize_t argc;
+    PyObject *func;  // the specialisation, NULL if the entry is unused
+} __pyx_FusedDispatchEntry;
+
+typedef struct {
+    __pyx_FusedDispatchEntry entries[__PYX_FUSED_DISPATCH_CACHE_SIZE];
+    int next_entry;
+    // Calls with more argument types than the cache can hold would only replace entries.
+    // The cache gives up after more stores than hits.
+    int disabled;
+    unsigned int hits;
+    unsigned int stores;
+} __pyx_FusedDispatchCache;
+
 typedef struct {
 #if !(CYTHON_COMPILING_IN_LIMITED_API && CYTHON_OPAQUE_OBJECTS)
     __pyx_CyFunctionObject func;
@@ -1627,6 +1657,13 @@ typedef struct {
 #if CYTHON_COMPILING_IN_LIMITED_API
     PyMethodDef *ml;
 #endif
+    // Bit masks of the argument positions that select the specialisation
+    // and of those that select a buffer specialisation. 0 disables the cache.
+    unsigned int dispatch_args;
+    unsigned int dispatch_buffer_args;
+    __pyx_FusedDispatchCache *dispatch_cache;
+    // Bound methods use the cache of the function that they were bound from.
+    PyObject *dispatch_owner;
 } __pyx_FusedFunctionObject;
 
 // Definition depends on whether we're using shared utility code or not
@@ -1687,6 +1724,10 @@ __pyx_FusedFunction_New(PyMethodDef *ml, int flags,
         __pyx_FusedFunctionObject *fusedfunc = __Pyx_as_FusedFunctionObject(op);
         fusedfunc->__signatures__ = NULL;
         fusedfunc->self = NULL;
+        fusedfunc->dispatch_args = 0;
+        fusedfunc->dispatch_buffer_args = 0;
+        fusedfunc->dispatch_cache = NULL;
+        fusedfunc->dispatch_owner = NULL;
         #if CYTHON_COMPILING_IN_LIMITED_API
         fusedfunc->ml = ml;
         #endif
@@ -1695,6 +1736,26 @@ __pyx_FusedFunction_New(PyMethodDef *ml, int flags,
     return op;
 }
 
+static void
+__pyx_FusedFunction_clear_dispatch_cache(__pyx_FusedFunctionObject *fused)
+{
+    __pyx_FusedDispatchCache *cache = fused->dispatch_cache;
+    int i, k;
+    Py_CLEAR(fused->dispatch_owner);
+    if (!cache)
+        return;
+    fused->dispatch_cache = NULL;
+    for (i = 0; i < __PYX_FUSED_DISPATCH_CACHE_SIZE; i++) {
+        __pyx_FusedDispatchEntry *entry = &cache->entries[i];
+        if (!entry->func)
+            continue;
+        for (k = 0; k < __PYX_FUSED_DISPATCH_MAX_ARGS; k++)
+            Py_XDECREF((PyObject *) entry->keys[k].type);
+        Py_DECREF(entry->func);
+    }
+    PyMem_Free(cache);
+}
+
 static void
 __pyx_FusedFunction_dealloc(PyObject *self)
 {
@@ -1702,6 +1763,7 @@ __pyx_FusedFunction_dealloc(PyObject *self)
     PyObject_GC_UnTrack(self);
     Py_CLEAR(fused->self);
     Py_CLEAR(fused->__signatures__);
+    __pyx_FusedFunction_clear_dispatch_cache(fused);
     __Pyx__CyFunction_dealloc(self);
 }
 
@@ -1714,6 +1776,18 @@ __pyx_FusedFunction_traverse(PyObject *self,
     // Visiting the type is handled in the CyFunction traverse if needed
     Py_VISIT(fused->self);
     Py_VISIT(fused->__signatures__);
+    Py_VISIT(fused->dispatch_owner);
+    if (fused->dispatch_cache) {
+        int i, k;
+        for (i = 0; i < __PYX_FUSED_DISPATCH_CACHE_SIZE; i++) {
+            __pyx_FusedDispatchEntry *entry = &fused->dispatch_cache->entries[i];
+            if (!entry->func)
+                continue;
+            for (k = 0; k < __PYX_FUSED_DISPATCH_MAX_ARGS; k++)
+                Py_VISIT((PyObject *) entry->keys[k].type);
+            Py_VISIT(entry->func);
+        }
+    }
     return __Pyx_CyFunction_traverse(self, visit, arg);
 }
 
@@ -1723,6 +1797,7 @@ __pyx_FusedFunction_clear(PyObject *self)
     __pyx_FusedFunctionObject *fused = __Pyx_as_FusedFunctionObject(self);
     Py_CLEAR(fused->self);
     Py_CLEAR(fused->__signatures__);
+    __pyx_FusedFunction_clear_dispatch_cache(fused);
     return __Pyx_CyFunction_clear(self);
 }
 
@@ -1784,6 +1859,11 @@ __pyx_FusedFunction_descr_get_locked(PyObject *self, PyObject *obj)
     Py_XINCREF(func->__signatures__);
     meth_as_fused->__signatures__ = func->__signatures__;
 
+    if (func->dispatch_args) {
+        Py_INCREF(self);
+        meth_as_fused->dispatch_owner = self;
+    }
+
     Py_XINCREF(cyfunc->defaults_tuple);
     meth_as_cyfunc->defaults_tuple = cyfunc->defaults_tuple;
 
@@ -1905,6 +1985,158 @@ __pyx_err:;
     return result_func;
 }
 
+// Builds the dispatch cache key from the fused arguments in 'args'.
+// Returns 0 (without an exception set) if the call cannot use the cache.
+static int
+__pyx_FusedFunction_dispatch_key(__pyx_FusedFunctionObject *owner, PyObject *args, Py_ssize_t argc,
+                                 __pyx_FusedDispatchKey *keys)
+{
+    unsigned int dispatch_args = owner->dispatch_args;
+    Py_ssize_t i;
+    int k = 0;
+    if (!dispatch_args)
+        return 0;
+    #if !CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    // Free-threaded builds check this in the critical section of the lookup instead.
+    if (owner->dispatch_cache && owner->dispatch_cache->disabled)
+        return 0;
+    #endif
+    for (i = 0; dispatch_args; i++, dispatch_args >>= 1) {
+        __pyx_FusedDispatchKey *key;
+        PyObject *arg;
+        if (!(dispatch_args & 1))
+            continue;
+        // Arguments that are passed by keyword or taken from the defaults are left to the dispatcher.
+        if (i >= argc)
+            return 0;
+        arg = __Pyx_PyTuple_GET_ITEM(args, i);
+        #if !CYTHON_ASSUME_SAFE_MACROS
+        if (unlikely(!arg)) {
+            PyErr_Clear();
+            return 0;
+        }
+        #endif
+        key = &keys[k++];
+        key->type = Py_TYPE(arg);
+        key->itemsize = 0;
+        key->ndim = -1;
+        key->format[0] = '\0';
+        if (!(owner->dispatch_buffer_args & (1U << i)))
+            continue;
+        #if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030b0000
+        return 0;
+        #else
+        if (PyObject_CheckBuffer(arg)) {
+            Py_buffer view;
+            const char *format;
+            size_t format_len;
+            if (unlikely(PyObject_GetBuffer(arg, &view, PyBUF_FULL_RO) == -1)) {
+                PyErr_Clear();
+                return 0;
+            }
+            format = view.format ? view.format : "B";
+            format_len = strlen(format);
+            if (view.suboffsets || format_len >= __PYX_FUSED_DISPATCH_MAX_FORMAT) {
+                PyBuffer_Release(&view);
+                return 0;
+            }
+            key->itemsize = view.itemsize;
+            key->ndim = view.ndim;
+            memcpy(key->format, format, format_len + 1);
+            PyBuffer_Release(&view);
+        }
+        #endif
+    }
+    for (; k < __PYX_FUSED_DISPATCH_MAX_ARGS; k++) {
+        keys[k].type = NULL;
+        keys[k].itemsize = 0;
+        keys[k].ndim = -1;
+        keys[k].format[0] = '\0';
+    }
+    return 1;
+}
+
+static int
+__pyx_FusedFunction_dispatch_key_matches(__pyx_FusedDispatchEntry *entry, Py_ssize_t argc,
+                                         __pyx_FusedDispatchKey *keys)
+{
+    int k;
+    if (!entry->func || entry->argc != argc)
+        return 0;
+    for (k = 0; k < __PYX_FUSED_DISPATCH_MAX_ARGS; k++) {
+        __pyx_FusedDispatchKey *key = &entry->keys[k];
+        if (key->type != keys[k].type)
+            return 0;
+        if (key->ndim != keys[k].ndim || key->itemsize != keys[k].itemsize ||
+                strcmp(key->format, keys[k].format) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+// Returns a new reference to the cached specialisation, or NULL without an exception set.
+// Clears 'use_cache' if the cache is disabled.
+static PyObject *
+__pyx_FusedFunction_dispatch_lookup(__pyx_FusedFunctionObject *owner, PyObject *owner_obj,
+                                    Py_ssize_t argc, __pyx_FusedDispatchKey *keys, int *use_cache)
+{
+    PyObject *func = NULL;
+    int i;
+    __Pyx_BEGIN_CRITICAL_SECTION(owner_obj);
+    __pyx_FusedDispatchCache *cache = owner->dispatch_cache;
+    if (cache && cache->disabled) {
+        *use_cache = 0;
+    } else if (cache) {
+        for (i = 0; i < __PYX_FUSED_DISPATCH_CACHE_SIZE; i++) {
+            __pyx_FusedDispatchEntry *entry = &cache->entries[i];
+            if (__pyx_FusedFunction_dispatch_key_matches(entry, argc, keys)) {
+                func = entry->func;
+                Py_INCREF(func);
+                if (cache->hits < UINT_MAX)
+                    cache->hits++;
+                break;
+            }
+        }
+    }
+    __Pyx_END_CRITICAL_SECTION();
+    return func;
+}
+
+// Remembers the specialisation for the key. Failing to allocate the cache is not an error.
+static void
+__pyx_FusedFunction_dispatch_store(__pyx_FusedFunctionObject *owner, PyObject *owner_obj,
+                                   Py_ssize_t argc, __pyx_FusedDispatchKey *keys, PyObject *func)
+{
+    // References of a replaced entry are released after leaving the critical section.
+    PyObject *old_refs[__PYX_FUSED_DISPATCH_MAX_ARGS + 1] = {0};
+    int k;
+    __Pyx_BEGIN_CRITICAL_SECTION(owner_obj);
+    if (!owner->dispatch_cache) {
+        owner->dispatch_cache = (__pyx_FusedDispatchCache *) PyMem_Calloc(1, sizeof(__pyx_FusedDispatchCache));
+    }
+    if (owner->dispatch_cache) {
+        __pyx_FusedDispatchCache *cache = owner->dispatch_cache;
+        __pyx_FusedDispatchEntry *entry = &cache->entries[cache->next_entry];
+        cache->stores++;
+        if (cache->stores > 32 && cache->stores > cache->hits)
+            cache->disabled = 1;
+        cache->next_entry = (cache->next_entry + 1) % __PYX_FUSED_DISPATCH_CACHE_SIZE;
+        old_refs[__PYX_FUSED_DISPATCH_MAX_ARGS] = entry->func;
+        for (k = 0; k < __PYX_FUSED_DISPATCH_MAX_ARGS; k++) {
+            old_refs[k] = (PyObject *) entry->keys[k].type;
+            entry->keys[k] = keys[k];
+            Py_XINCREF((PyObject *) keys[k].type);
+        }
+        entry->argc = argc;
+        Py_INCREF(func);
+        entry->func = func;
+    }
+    __Pyx_END_CRITICAL_SECTION();
+    for (k = 0; k <= __PYX_FUSED_DISPATCH_MAX_ARGS; k++) {
+        Py_XDECREF(old_refs[k]);
+    }
+}
+
 static PyObject *
 __pyx_FusedFunction_callfunction(PyObject *func, PyObject *args, PyObject *kw)
 {
@@ -1971,6 +2203,18 @@ __pyx_FusedFunction_call(PyObject *func, PyObject *args, PyObject *kw)
 
     if (binding_func->__signatures__) {
         PyObject *tup;
+        PyObject *owner_obj = binding_func->dispatch_owner ? binding_func->dispatch_owner : func;
+        __pyx_FusedFunctionObject *owner = __Pyx_as_FusedFunctionObject(owner_obj);
+        __pyx_FusedDispatchKey keys[__PYX_FUSED_DISPATCH_MAX_ARGS];
+        Py_ssize_t dispatch_argc = __Pyx_PyTuple_GET_SIZE(args);
+        int use_cache = kw == NULL && !(is_staticmethod && cyfunc->flags & __Pyx_CYFUNCTION_CCLASS) &&
+            __pyx_FusedFunction_dispatch_key(owner, args, dispatch_argc, keys);
+        if (use_cache) {
+            new_func = __pyx_FusedFunction_dispatch_lookup(owner, owner_obj, dispatch_argc, keys, &use_cache);
+            if (new_func)
+                goto call;
+        }
+
         if (is_staticmethod && cyfunc->flags & __Pyx_CYFUNCTION_CCLASS) {
             // FIXME: this seems wrong, but we must currently pass the signatures dict as 'self' argument
             tup = PyTuple_Pack(3, args,
@@ -1991,6 +2235,10 @@ __pyx_FusedFunction_call(PyObject *func, PyObject *args, PyObject *kw)
         if (unlikely(!new_func))
             goto bad;
 
+        if (use_cache)
+            __pyx_FusedFunction_dispatch_store(owner, owner_obj, dispatch_argc, keys, new_func);
+
+      call:
         assert(__Pyx_CyFunction_GetClassObj(new_func) == __Pyx_CyFunction_GetClassObj(func));
 
         func = new_func;
@@ -238,11 +238,28 @@ static void __Pyx_RejectKeywords(const char* function_name, PyObject *kwds) {
 }
 
 
+//////////////////// KeywordHashTable.proto ////////////////////
+
+// Perfect hash table of the keyword argument names of a function, generated at compile time.
+// The hash combines the length of the name with the characters at a few positions that
+// distinguish the names.  It selects a bucket whose displacement is mixed into the hash
+// to find the slot, which holds the index of the name in 'argnames' plus one (0 = empty).
+// There are as many buckets as slots.
+typedef struct {
+    const unsigned char *positions;
+    const unsigned char *displacements;
+    const unsigned char *slots;
+    unsigned int num_positions;
+    uint32_t mask;
+} __Pyx_KeywordHashTable;
+
 //////////////////// ParseKeywords.proto ////////////////////
+//@requires: KeywordHashTable
 //@requires: ParseKeywordsImpl
 
 static CYTHON_INLINE int __Pyx_ParseKeywords(
     PyObject *kwds, PyObject *const *kwvalues, PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
     PyObject *kwds2, PyObject *values[],
     Py_ssize_t num_pos_args, Py_ssize_t num_kwargs,
     const char* function_name,
@@ -265,12 +282,16 @@ static CYTHON_INLINE int __Pyx_ParseKeywords(
 //  arguments that were passed and that must therefore not appear
 //  amongst the keywords as well.
 //
+//  If hash_table is not NULL, it maps the names in argnames to their
+//  index, so that the keywords are looked up without searching argnames.
+//
 //  This method does not check for required keyword arguments.
 
 static int __Pyx_ParseKeywords(
     PyObject *kwds,
     PyObject * const *kwvalues,
     PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
     PyObject *kwds2,
     PyObject *values[],
     Py_ssize_t num_pos_args,
@@ -278,18 +299,23 @@ static int __Pyx_ParseKeywords(
     const char* function_name,
     int ignore_unknown_kwargs)
 {
+    #if !CYTHON_USE_UNICODE_INTERNALS
+    // The hash needs direct access to the characters of the keyword names.
+    hash_table = NULL;
+    #endif
     // Only called if kwds contains at least one optional keyword argument.
     if (CYTHON_VECTORCALL && likely(PyTuple_Check(kwds)))
-        return __Pyx_ParseKeywordsTuple(kwds, kwvalues, argnames, kwds2, values, num_pos_args, num_kwargs, function_name, ignore_unknown_kwargs);
+        return __Pyx_ParseKeywordsTuple(kwds, kwvalues, argnames, hash_table, kwds2, values, num_pos_args, num_kwargs, function_name, ignore_unknown_kwargs);
     else if (kwds2)
         return __Pyx_ParseKeywordDictToDict(kwds, argnames, kwds2, values, num_pos_args, function_name);
     else
-        return __Pyx_ParseKeywordDict(kwds, argnames, values, num_pos_args, num_kwargs, function_name, ignore_unknown_kwargs);
+        return __Pyx_ParseKeywordDict(kwds, argnames, hash_table, values, num_pos_args, num_kwargs, function_name, ignore_unknown_kwargs);
 }
 
 
 //////////////////// ParseKeywordsImpl.export ////////////////////
 //@feature: DEFAULTS
+//@requires: KeywordHashTable
 //@requires: RaiseDoubleKeywords
 //@requires: Synchronization.c::CriticalSections
 //@requires: ObjectHandling.c::OwnedDictNext
@@ -299,6 +325,7 @@ static int __Pyx_ParseKeywordsTuple(
     PyObject *kwds,
     PyObject * const *kwvalues,
     PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
     PyObject *kwds2,
     PyObject *values[],
     Py_ssize_t num_pos_args,
@@ -319,6 +346,7 @@ static int __Pyx_ParseKeywordDictToDict(
 static int __Pyx_ParseKeywordDict(
     PyObject *kwds,
     PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
     PyObject *values[],
     Py_ssize_t num_pos_args,
     Py_ssize_t num_kwargs,
@@ -506,6 +534,55 @@ static CYTHON_INLINE int __Pyx_MatchKeywordArg(
         __Pyx_MatchKeywordArg_nostr(key, argnames, first_kw_arg, index_found, function_name);
 }
 
+#if CYTHON_USE_UNICODE_INTERNALS
+static CYTHON_INLINE int __Pyx_MatchKeywordArgHashed(
+    PyObject *key,
+    PyObject ** const argnames[],
+    PyObject ** const *first_kw_arg,
+    const __Pyx_KeywordHashTable *hash_table,
+    size_t *index_found,
+    const char *function_name)
+{
+    // Look up the only candidate name in the perfect hash table.
+    // Must stay in sync with the hash function in Nodes.py.
+    Py_ssize_t length, index;
+    const void *data;
+    int kind;
+    uint32_t hash, displacement;
+    unsigned int i;
+
+    if (unlikely(!PyUnicode_CheckExact(key)))
+        return __Pyx_MatchKeywordArg_nostr(key, argnames, first_kw_arg, index_found, function_name);
+
+    length = PyUnicode_GET_LENGTH(key);
+    kind = PyUnicode_KIND(key);
+    data = PyUnicode_DATA(key);
+    hash = 0x811c9dc5U;
+    for (i = 0; i < hash_table->num_positions; i++) {
+        Py_ssize_t position = hash_table->positions[i];
+        uint32_t ch = (position < length) ? (uint32_t) PyUnicode_READ(kind, data, position) : 0;
+        hash = (hash ^ ch) * 0x01000193U;
+    }
+    hash = (hash ^ (uint32_t) length) * 0x01000193U;
+    displacement = hash_table->displacements[(hash ^ (hash >> 15)) & hash_table->mask];
+    hash = (hash ^ displacement) * 0x01000193U;
+    index = (Py_ssize_t) hash_table->slots[(hash ^ (hash >> 15)) & hash_table->mask] - 1;
+
+    if (index >= 0) {
+        PyObject *name_str = *argnames[index];
+        if (name_str == key || __Pyx_UnicodeKeywordsEqual(name_str, key)) {
+            if (unlikely(argnames + index < first_kw_arg)) {
+                __Pyx_RaiseDoubleKeywordsError(function_name, key);
+                return -1;
+            }
+            *index_found = (size_t) index;
+            return 1;
+        }
+    }
+    return 0;
+}
+#endif
+
 static void __Pyx_RejectUnknownKeyword(
     PyObject *kwds,
     PyObject ** const argnames[],
@@ -564,9 +641,64 @@ static void __Pyx_RejectUnknownKeyword(
     assert(PyErr_Occurred());
 }
 
+#if CYTHON_USE_UNICODE_INTERNALS
+static int __Pyx_ParseKeywordDictHashed(
+    PyObject *kwds,
+    PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
+    PyObject *values[],
+    Py_ssize_t num_pos_args,
+    const char* function_name,
+    int ignore_unknown_kwargs)
+{
+    // Look up each passed keyword instead of each declared name.
+    PyObject** const *first_kw_arg = argnames + num_pos_args;
+    #if CYTHON_AVOID_BORROWED_REFS
+    PyObject *pos = NULL;
+    #else
+    Py_ssize_t pos = 0;
+    #endif
+    PyObject *key = NULL, *value = NULL;
+    int result = 0;
+
+    __Pyx_BEGIN_CRITICAL_SECTION(kwds);
+    #if CYTHON_AVOID_BORROWED_REFS
+    while (__Pyx_PyDict_NextRef(kwds, &pos, &key, &value))
+    #else
+    (void) __Pyx_PyDict_NextRef;
+    while (PyDict_Next(kwds, &pos, &key, &value))
+    #endif
+    {
+        size_t index_found = 0;
+        int cmp = __Pyx_MatchKeywordArgHashed(key, argnames, first_kw_arg, hash_table, &index_found, function_name);
+        if (cmp == 1) {
+            values[index_found] = __Pyx_NewRef(value);
+        } else if (cmp == -1 || !ignore_unknown_kwargs) {
+            if (cmp == 0) {
+                PyErr_Format(PyExc_TypeError,
+                    "%s() got an unexpected keyword argument '%U'",
+                    function_name, key);
+            }
+            result = -1;
+        }
+        #if CYTHON_AVOID_BORROWED_REFS
+        Py_DECREF(key);
+        Py_DECREF(value);
+        #endif
+        if (unlikely(result == -1)) break;
+    }
+    __Pyx_END_CRITICAL_SECTION();
+    #if CYTHON_AVOID_BORROWED_REFS
+    Py_XDECREF(pos);
+    #endif
+    return result;
+}
+#endif
+
 static int __Pyx_ParseKeywordDict(
     PyObject *kwds,
     PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
     PyObject *values[],
     Py_ssize_t num_pos_args,
     Py_ssize_t num_kwargs,
@@ -582,6 +714,13 @@ static int __Pyx_ParseKeywordDict(
     if (unlikely(!PyArg_ValidateKeywordArguments(kwds))) return -1;
 #endif
 
+#if CYTHON_USE_UNICODE_INTERNALS
+    if (hash_table)
+        return __Pyx_ParseKeywordDictHashed(kwds, argnames, hash_table, values, num_pos_args, function_name, ignore_unknown_kwargs);
+#else
+    (void) hash_table;
+#endif
+
     // Extract declared keyword arguments.
     name = first_kw_arg;
     while (*name && num_kwargs > extracted) {
@@ -703,6 +842,7 @@ static int __Pyx_ParseKeywordsTuple(
     PyObject *kwds,
     PyObject * const *kwvalues,
     PyObject ** const argnames[],
+    const __Pyx_KeywordHashTable *hash_table,
     PyObject *kwds2,
     PyObject *values[],
     Py_ssize_t num_pos_args,
@@ -724,29 +864,37 @@ static int __Pyx_ParseKeywordsTuple(
         if (unlikely(!key)) goto bad;
 #endif
 
-        // Quick pointer search for interned parameter matches (will usually succeed).
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            // Declared keyword: **name == key
+        size_t index_found = 0;
+        int cmp;
+        #if CYTHON_USE_UNICODE_INTERNALS
+        if (hash_table) {
+            cmp = __Pyx_MatchKeywordArgHashed(key, argnames, first_kw_arg, hash_table, &index_found, function_name);
+        } else
+        #endif
+        {
+            // Quick pointer search for interned parameter matches (will usually succeed).
+            name = first_kw_arg;
+            while (*name && (**name != key)) name++;
+            if (*name) {
+                // Declared keyword: **name == key
+                index_found = (size_t) (name - argnames);
+                cmp = 1;
+            } else {
+                cmp = __Pyx_MatchKeywordArg(key, argnames, first_kw_arg, &index_found, function_name);
+            }
+        }
+
+        if (cmp == 1) {
+            // Found in declared keywords => assign value.
             PyObject *value = kwvalues[pos];
-            values[name-argnames] = __Pyx_NewRef(value);
+            values[index_found] = __Pyx_NewRef(value);
         } else {
-            size_t index_found = 0;
-            int cmp = __Pyx_MatchKeywordArg(key, argnames, first_kw_arg, &index_found, function_name);
-
-            if (cmp == 1) {
-                // Found in declared keywords => assign value.
+            if (unlikely(cmp == -1)) goto bad;
+            if (kwds2) {
                 PyObject *value = kwvalues[pos];
-                values[index_found] = __Pyx_NewRef(value);
-            } else {
-                if (unlikely(cmp == -1)) goto bad;
-                if (kwds2) {
-                    PyObject *value = kwvalues[pos];
-                    if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                } else if (!ignore_unknown_kwargs) {
-                    goto invalid_keyword;
-                }
+                if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
+            } else if (!ignore_unknown_kwargs) {
+                goto invalid_keyword;
             }
         }
 
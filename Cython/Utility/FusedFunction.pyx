@@ -24,6 +24,9 @@ cdef object index_signature(dest_sig: tuple, signatures: dict, sigindex: dict):
             if dest_type != type_name:
                 break
         else:
+            if matched_function is function:
+                # merged specializations map to the same function
+                continue
             if matched_function is not None:
                 raise TypeError("Function call with ambiguous argument types")
             matched_function = function
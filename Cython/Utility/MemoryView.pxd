@@ -45,6 +45,11 @@ cdef class array:
         # cdef object _memview
         cdef bint free_data
         cdef bint dtype_is_object
+        # 'data' is aligned to this (if not 0) and starts within '_alloc_data'
+        readonly Py_ssize_t alignment
+        void *_alloc_data
+        int _pool_class
+        bint _padded
 
     @cname('get_memview')
     cdef get_memview(self)
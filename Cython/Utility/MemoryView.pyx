@@ -113,6 +113,11 @@ cdef extern from "<stdlib.h>":
     void free(void *) nogil
     void *memcpy(void *dest, void *src, size_t n) nogil
 
+cdef extern from *:
+    int array_pool_class "__pyx_array_pool_class"(size_t size, size_t alignment) nogil
+    void *array_alloc "__pyx_array_alloc"(size_t size, size_t alignment, int pool_class, void **alloc_data) nogil
+    void array_free "__pyx_array_free"(void *alloc_data, int pool_class) nogil
+
 # the sequence abstract base class
 cdef object __pyx_collections_abc_Sequence "__pyx_collections_abc_Sequence"
 try:
@@ -143,9 +148,15 @@ cdef class array:
         # cdef object _memview
         cdef bint free_data
         cdef bint dtype_is_object
+        # 'data' is aligned to this (if not 0) and starts within '_alloc_data'
+        readonly Py_ssize_t alignment
+        void *_alloc_data
+        int _pool_class
+        bint _padded
 
     def __cinit__(array self, tuple shape, Py_ssize_t itemsize, format not None,
-                  mode="c", bint allocate_buffer=True):
+                  mode="c", bint allocate_buffer=True, *,
+                  Py_ssize_t alignment=0, bint padded=False, bint pooled=False):
 
         cdef int idx
         cdef Py_ssize_t dim
@@ -159,6 +170,13 @@ cdef class array:
         if cython.unlikely(itemsize <= 0):
             _err_ValueError("itemsize <= 0 for cython.array")
 
+        if cython.unlikely(alignment < 0 or alignment & (alignment - 1)):
+            _err_ValueError("alignment must be a power of two for cython.array")
+        if cython.unlikely(padded and not alignment):
+            _err_ValueError("padded cython.array requires an alignment")
+        self.alignment = alignment
+        self._pool_class = -1
+
         if not isinstance(format, bytes):
             format = format.encode('ASCII')
         self._format = format  # keep a reference to the byte string
@@ -192,13 +210,25 @@ cdef class array:
         self.free_data = allocate_buffer
         self.dtype_is_object = format == b'O'
 
+        if padded and self.ndim > 1:
+            if cython.unlikely(self.dtype_is_object):
+                _err_ValueError("padded cython.array cannot hold objects")
+            _pad_rows(self, order)
+
         if allocate_buffer:
+            if pooled:
+                self._pool_class = array_pool_class(<size_t> self.len, <size_t> alignment)
             _allocate_buffer(self)
 
     @cname('getbuffer')
     def __getbuffer__(self, Py_buffer *info, int flags):
-        cdef int bufmode = -1
-        if flags & (PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS):
+        cdef int i, bufmode = -1
+        if self._padded:
+            # the contiguity flags include PyBUF_STRIDES, only look at their own bits
+            if cython.unlikely(flags & (PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS) & ~PyBUF_STRIDES or
+                               (flags & PyBUF_STRIDES) != PyBUF_STRIDES):
+                _err_ValueError("Can only create a strided buffer of a padded array.")
+        elif flags & (PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS):
             if self.mode == u"c":
                 bufmode = PyBUF_C_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS
             elif self.mode == u"fortran":
@@ -207,6 +237,11 @@ cdef class array:
                 _err_ValueError("Can only create a buffer that is contiguous in memory.")
         info.buf = self.data
         info.len = self.len
+        if self._padded:
+            # the length of the items without padding
+            info.len = self.itemsize
+            for i in range(self.ndim):
+                info.len *= self._shape[i]
 
         if flags & PyBUF_STRIDES:
             info.ndim = self.ndim
@@ -229,7 +264,10 @@ cdef class array:
         elif self.free_data and self.data is not NULL:
             if self.dtype_is_object:
                 refcount_objects_in_slice(self.data, self._shape, self._strides, self.ndim, inc=False)
-            free(self.data)
+            if self._alloc_data is not NULL:
+                array_free(self._alloc_data, self._pool_class)
+            else:
+                free(self.data)
         PyObject_Free(self._shape)
 
     @property
@@ -239,7 +277,7 @@ cdef class array:
     # treat as cython_final
     @cname('get_memview')
     cdef get_memview(self):
-        flags =  PyBUF_ANY_CONTIGUOUS|PyBUF_FORMAT|PyBUF_WRITABLE
+        flags = (PyBUF_STRIDES if self._padded else PyBUF_ANY_CONTIGUOUS)|PyBUF_FORMAT|PyBUF_WRITABLE
         return  memoryview(self, flags, self.dtype_is_object)
 
     def __len__(self):
@@ -269,7 +307,11 @@ cdef int _allocate_buffer(array self) except -1:
     cdef PyObject **p
 
     self.free_data = True
-    self.data = <char *>malloc(<size_t> self.len)
+    if self.alignment or self._pool_class >= 0:
+        self.data = <char *>array_alloc(<size_t> self.len, <size_t> self.alignment,
+                                        self._pool_class, &self._alloc_data)
+    else:
+        self.data = <char *>malloc(<size_t> self.len)
     if not self.data:
         raise MemoryError, "unable to allocate array data."
 
@@ -281,6 +323,30 @@ cdef int _allocate_buffer(array self) except -1:
     return 0
 
 
+cdef void _pad_rows(array self, char order) noexcept:
+    """
+    Round up the stride of the dimension next to the contiguous one to a
+    multiple of the alignment, so that each row (or column) starts aligned.
+    """
+    cdef int inner = self.ndim - 1 if order == b'C' else 0
+    cdef Py_ssize_t row = self._shape[inner] * self.itemsize
+    cdef Py_ssize_t stride = (row + self.alignment - 1) & ~(self.alignment - 1)
+    cdef int idx
+    if stride == row:
+        return
+
+    self._padded = True
+    if order == b'C':
+        for idx in range(self.ndim - 2, -1, -1):
+            self._strides[idx] = stride
+            stride *= self._shape[idx]
+    else:
+        for idx in range(1, self.ndim):
+            self._strides[idx] = stride
+            stride *= self._shape[idx]
+    self.len = stride
+
+
 @cname("__pyx_array_new")
 cdef array array_cwrapper(tuple shape, Py_ssize_t itemsize, char *format, const char *c_mode, char *buf):
     cdef array result
@@ -919,8 +985,9 @@ cdef char *pybuffer_index(Py_buffer *view, char *bufp, Py_ssize_t index,
 #
 @cname('__pyx_memslice_transpose')
 cdef int transpose_memslice({{memviewslice_name}} *memslice) except -1 nogil:
-    cdef int ndim = memslice.memview.view.ndim
+    return transpose_memslice_dims(memslice, memslice.memview.view.ndim)
 
+cdef int transpose_memslice_dims({{memviewslice_name}} *memslice, int ndim) except -1 nogil:
     cdef Py_ssize_t *shape = memslice.shape
     cdef Py_ssize_t *strides = memslice.strides
 
@@ -1126,42 +1193,150 @@ cdef char get_best_order({{memviewslice_name}} *mslice, int ndim) noexcept nogil
     else:
         return 'F'
 
-@cython.cdivision(True)
+cdef extern from *:
+    ctypedef void (*copy_rows_func "__pyx_memoryview_copy_rows_func")(void *, Py_ssize_t, Py_ssize_t) noexcept nogil
+    void run_copy "__pyx_memoryview_run_copy"(copy_rows_func copy_rows, void *job,
+                                              Py_ssize_t nrows, size_t nbytes) noexcept nogil
+
+# Named, since anonymous enums of utility code clash with those of the user module.
+cdef enum _CopyTile:
+    # Edge length (in items) of the tiles that are copied between differing memory layouts.
+    COPY_TILE_SIZE = 32
+
+cdef struct _CopyJob:
+    char *src_data
+    char *dst_data
+    Py_ssize_t src_strides[{{max_dims}}]
+    Py_ssize_t dst_strides[{{max_dims}}]
+    Py_ssize_t shape[{{max_dims}}]
+    int ndim
+    size_t itemsize
+
+cdef void _copy_items(char *src_data, Py_ssize_t src_stride,
+                      char *dst_data, Py_ssize_t dst_stride,
+                      Py_ssize_t extent, size_t itemsize) noexcept nogil:
+    # Constant sizes let the C compiler replace memcpy() with plain loads and stores.
+    cdef Py_ssize_t i
+    if itemsize == 8:
+        for i in range(extent):
+            memcpy(dst_data, src_data, 8)
+            src_data += src_stride
+            dst_data += dst_stride
+    elif itemsize == 4:
+        for i in range(extent):
+            memcpy(dst_data, src_data, 4)
+            src_data += src_stride
+            dst_data += dst_stride
+    elif itemsize == 16:
+        for i in range(extent):
+            memcpy(dst_data, src_data, 16)
+            src_data += src_stride
+            dst_data += dst_stride
+    else:
+        for i in range(extent):
+            memcpy(dst_data, src_data, itemsize)
+            src_data += src_stride
+            dst_data += dst_stride
+
+cdef void _copy_tiled(char *src_data, Py_ssize_t *src_strides,
+                      char *dst_data, Py_ssize_t *dst_strides,
+                      Py_ssize_t *shape, size_t itemsize) noexcept nogil:
+    """
+    Copy two dimensions in square tiles, so that the reads and writes stay
+    within a few cache lines of both slices when their layouts differ.
+    """
+    cdef Py_ssize_t i, i0 = 0, i_end, j0, j_end
+
+    while i0 < shape[0]:
+        i_end = min(i0 + COPY_TILE_SIZE, shape[0])
+        j0 = 0
+        while j0 < shape[1]:
+            j_end = min(j0 + COPY_TILE_SIZE, shape[1])
+            for i in range(i0, i_end):
+                _copy_items(src_data + i * src_strides[0] + j0 * src_strides[1], src_strides[1],
+                            dst_data + i * dst_strides[0] + j0 * dst_strides[1], dst_strides[1],
+                            j_end - j0, itemsize)
+            j0 = j_end
+        i0 = i_end
+
+cdef bint _layouts_differ(Py_ssize_t *src_strides, Py_ssize_t *dst_strides, Py_ssize_t *shape) noexcept nogil:
+    # Only worth tiling if one slice runs along the other dimension than the iteration.
+    if shape[0] <= COPY_TILE_SIZE or shape[1] <= COPY_TILE_SIZE:
+        return False
+    return (abs_py_ssize_t(src_strides[0]) < abs_py_ssize_t(src_strides[1]) or
+            abs_py_ssize_t(dst_strides[0]) < abs_py_ssize_t(dst_strides[1]))
+
 cdef void _copy_strided_to_strided(char *src_data, Py_ssize_t *src_strides,
                                    char *dst_data, Py_ssize_t *dst_strides,
-                                   Py_ssize_t *src_shape, Py_ssize_t *dst_shape,
-                                   int ndim, size_t itemsize) noexcept nogil:
-    # Note: src_extent is 1 if we're broadcasting
-    # dst_extent always >= src_extent as we don't do reductions
+                                   Py_ssize_t *shape, int ndim, size_t itemsize) noexcept nogil:
+    # Broadcast dimensions have a source stride of 0
     cdef Py_ssize_t i
-    cdef Py_ssize_t src_extent = src_shape[0]
-    cdef Py_ssize_t dst_extent = dst_shape[0]
+    cdef Py_ssize_t extent = shape[0]
     cdef Py_ssize_t src_stride = src_strides[0]
     cdef Py_ssize_t dst_stride = dst_strides[0]
 
     if ndim == 1:
         if (src_stride > 0 and dst_stride > 0 and
                 <size_t> src_stride == itemsize == <size_t> dst_stride):
-            memcpy(dst_data, src_data, itemsize * <size_t> dst_extent)
+            memcpy(dst_data, src_data, itemsize * <size_t> extent)
         else:
-            for i in range(dst_extent):
-                memcpy(dst_data, src_data, itemsize)
-                src_data += src_stride
-                dst_data += dst_stride
+            _copy_items(src_data, src_stride, dst_data, dst_stride, extent, itemsize)
+    elif ndim == 2 and _layouts_differ(src_strides, dst_strides, shape):
+        _copy_tiled(src_data, src_strides, dst_data, dst_strides, shape, itemsize)
     else:
-        for i in range(dst_extent):
+        for i in range(extent):
             _copy_strided_to_strided(src_data, src_strides + 1,
                                      dst_data, dst_strides + 1,
-                                     src_shape + 1, dst_shape + 1,
-                                     ndim - 1, itemsize)
+                                     shape + 1, ndim - 1, itemsize)
             src_data += src_stride
             dst_data += dst_stride
 
+cdef void _copy_rows(void *job_arg, Py_ssize_t begin, Py_ssize_t end) noexcept nogil:
+    cdef _CopyJob *job = <_CopyJob *> job_arg
+    cdef Py_ssize_t shape[{{max_dims}}]
+    cdef int i
+    shape[0] = end - begin
+    for i in range(1, job.ndim):
+        shape[i] = job.shape[i]
+    _copy_strided_to_strided(job.src_data + begin * job.src_strides[0], job.src_strides,
+                             job.dst_data + begin * job.dst_strides[0], job.dst_strides,
+                             shape, job.ndim, job.itemsize)
+
 cdef void copy_strided_to_strided({{memviewslice_name}} *src,
                                   {{memviewslice_name}} *dst,
                                   int ndim, size_t itemsize) noexcept nogil:
-    _copy_strided_to_strided(src.data, src.strides, dst.data, dst.strides,
-                             src.shape, dst.shape, ndim, itemsize)
+    """
+    Copy the items of src to dst (of the same shape, or broadcast), after
+    dropping dimensions of extent 1 and merging dimensions that are
+    contiguous in both slices into longer runs.
+    """
+    cdef _CopyJob job
+    cdef int i, n = 0
+    cdef size_t nbytes = itemsize
+
+    job.src_data = src.data
+    job.dst_data = dst.data
+    job.itemsize = itemsize
+    for i in range(ndim):
+        nbytes *= <size_t> dst.shape[i]
+        if dst.shape[i] == 1:
+            continue
+        if (n and job.src_strides[n-1] == src.strides[i] * dst.shape[i] and
+                job.dst_strides[n-1] == dst.strides[i] * dst.shape[i]):
+            job.shape[n-1] *= dst.shape[i]
+            job.src_strides[n-1] = src.strides[i]
+            job.dst_strides[n-1] = dst.strides[i]
+        else:
+            job.shape[n] = dst.shape[i]
+            job.src_strides[n] = src.strides[i]
+            job.dst_strides[n] = dst.strides[i]
+            n += 1
+
+    if n == 0:
+        memcpy(dst.data, src.data, itemsize)
+        return
+    job.ndim = n
+    run_copy(_copy_rows, &job, job.shape[0], nbytes)
 
 @cname('__pyx_memoryview_slice_get_size')
 cdef size_t slice_get_size({{memviewslice_name}} *src, int ndim) noexcept nogil:
@@ -1336,8 +1511,8 @@ cdef int memoryview_copy_contents({{memviewslice_name}} src,
     if order == 'F' == get_best_order(&dst, ndim):
         # see if both slices have Fortran order, transpose them to match our
         # C-style indexing order
-        transpose_memslice(&src)
-        transpose_memslice(&dst)
+        transpose_memslice_dims(&src, ndim)
+        transpose_memslice_dims(&dst, ndim)
 
     refcount_copying(&dst, dtype_is_object, ndim, inc=False)
     copy_strided_to_strided(&src, &dst, ndim, itemsize)
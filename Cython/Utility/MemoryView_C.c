@@ -263,7 +263,7 @@ static int __Pyx_ValidateAndInit_memviewslice(
 
     if (new_memview) {
         __Pyx_BufFmt_Init(&ctx, stack, dtype);
-        if (unlikely(!__Pyx_BufFmt_CheckString(&ctx, buf->format))) goto fail;
+        if (unlikely(!__Pyx_BufFmt_CheckFormat(&ctx, buf->format))) goto fail;
     }
 
     if (unlikely((unsigned) buf->itemsize != dtype->size)) {
@@ -674,6 +674,185 @@ __pyx_slices_overlap($memviewslice_cname *slice1,
 }
 
 
+////////// ArrayAllocation.proto //////////
+
+/* Number of freed blocks that each thread keeps per size class for pooled arrays. */
+#ifndef CYTHON_ARRAY_POOL_SIZE
+#define CYTHON_ARRAY_POOL_SIZE 4
+#endif
+
+/* Pooled blocks of 64 bytes up to 4 KiB, aligned to 64 bytes. */
+#define __PYX_ARRAY_POOL_MIN_SIZE 64
+#define __PYX_ARRAY_POOL_CLASSES 7
+#define __PYX_ARRAY_POOL_ALIGNMENT 64
+
+static int __pyx_array_pool_class(size_t size, size_t alignment);
+static void *__pyx_array_alloc(size_t size, size_t alignment, int pool_class, void **alloc_data);
+static void __pyx_array_free(void *alloc_data, int pool_class);
+
+
+////////// ArrayAllocation //////////
+
+#ifndef CYTHON_THREAD_LOCAL
+  #if defined(__cplusplus) && __cplusplus >= 201103L
+    #define CYTHON_THREAD_LOCAL thread_local
+  #elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112
+    #define CYTHON_THREAD_LOCAL _Thread_local
+  #elif defined(__GNUC__)
+    #define CYTHON_THREAD_LOCAL __thread
+  #elif defined(_MSC_VER)
+    #define CYTHON_THREAD_LOCAL __declspec(thread)
+  #endif
+#endif
+
+#if defined(CYTHON_THREAD_LOCAL) && CYTHON_ARRAY_POOL_SIZE > 0
+/* Blocks of threads that end are not returned to the system. */
+static CYTHON_THREAD_LOCAL void *__pyx_array_pool[__PYX_ARRAY_POOL_CLASSES][CYTHON_ARRAY_POOL_SIZE];
+static CYTHON_THREAD_LOCAL int __pyx_array_pool_count[__PYX_ARRAY_POOL_CLASSES];
+#define __PYX_ARRAY_USE_POOL 1
+#else
+#define __PYX_ARRAY_USE_POOL 0
+#endif
+
+/* Returns the size class of a pooled allocation, or -1 if it is not pooled. */
+static int __pyx_array_pool_class(size_t size, size_t alignment) {
+    int pool_class = 0;
+    if (!__PYX_ARRAY_USE_POOL || alignment > __PYX_ARRAY_POOL_ALIGNMENT)
+        return -1;
+    while (((size_t) __PYX_ARRAY_POOL_MIN_SIZE << pool_class) < size) {
+        if (++pool_class == __PYX_ARRAY_POOL_CLASSES)
+            return -1;
+    }
+    return pool_class;
+}
+
+/* Allocates 'size' bytes at a multiple of 'alignment' (a power of two, or 0).
+   The block to free is returned in 'alloc_data'. */
+static void *__pyx_array_alloc(size_t size, size_t alignment, int pool_class, void **alloc_data) {
+    char *block = NULL;
+    if (pool_class >= 0) {
+        size = (size_t) __PYX_ARRAY_POOL_MIN_SIZE << pool_class;
+        alignment = __PYX_ARRAY_POOL_ALIGNMENT;
+#if __PYX_ARRAY_USE_POOL
+        if (__pyx_array_pool_count[pool_class])
+            block = (char *) __pyx_array_pool[pool_class][--__pyx_array_pool_count[pool_class]];
+#endif
+    }
+    if (alignment == 0)
+        alignment = 1;
+    if (!block) {
+        if (unlikely(size > (size_t) PY_SSIZE_T_MAX - alignment))
+            return NULL;
+        block = (char *) malloc(size + alignment - 1);
+        if (unlikely(!block))
+            return NULL;
+    }
+    *alloc_data = block;
+    return (void *) (((__pyx_uintptr_t) block + alignment - 1) & ~(__pyx_uintptr_t) (alignment - 1));
+}
+
+static void __pyx_array_free(void *alloc_data, int pool_class) {
+#if __PYX_ARRAY_USE_POOL
+    if (pool_class >= 0 && __pyx_array_pool_count[pool_class] < CYTHON_ARRAY_POOL_SIZE) {
+        __pyx_array_pool[pool_class][__pyx_array_pool_count[pool_class]++] = alloc_data;
+        return;
+    }
+#else
+    CYTHON_UNUSED_VAR(pool_class);
+#endif
+    free(alloc_data);
+}
+
+
+////////// MemviewParallelCopy.proto //////////
+
+/* Copies of at least this size are split between OpenMP threads (if available). */
+#ifndef CYTHON_MEMVIEW_PARALLEL_COPY_MIN_BYTES
+#define CYTHON_MEMVIEW_PARALLEL_COPY_MIN_BYTES (16 * 1024 * 1024)
+#endif
+
+typedef void (*__pyx_memoryview_copy_rows_func)(void *job, Py_ssize_t begin, Py_ssize_t end);
+
+static void __pyx_memoryview_run_copy(__pyx_memoryview_copy_rows_func copy_rows, void *job,
+                                      Py_ssize_t nrows, size_t nbytes);
+
+
+////////// MemviewParallelCopy //////////
+
+static void __pyx_memoryview_run_copy(__pyx_memoryview_copy_rows_func copy_rows, void *job,
+                                      Py_ssize_t nrows, size_t nbytes) {
+#ifdef _OPENMP
+    if (nrows > 1 && nbytes >= CYTHON_MEMVIEW_PARALLEL_COPY_MIN_BYTES && !omp_in_parallel()) {
+        #pragma omp parallel
+        {
+            Py_ssize_t nthreads = omp_get_num_threads();
+            Py_ssize_t chunk = (nrows + nthreads - 1) / nthreads;
+            Py_ssize_t begin = chunk * omp_get_thread_num();
+            Py_ssize_t end = (begin + chunk < nrows) ? begin + chunk : nrows;
+            if (begin < end)
+                copy_rows(job, begin, end);
+        }
+        return;
+    }
+#else
+    CYTHON_UNUSED_VAR(nbytes);
+#endif
+    copy_rows(job, 0, nrows);
+}
+
+
+////////// MemviewSliceCheckExtents.proto //////////
+
+static int __pyx_memviewslice_check_extents(const Py_ssize_t *shape1, const Py_ssize_t *shape2,
+                                            int ndim, int have_gil); /*proto*/
+
+////////// MemviewSliceCheckExtents //////////
+
+/* Raises a ValueError and returns -1 if the shapes differ in any dimension */
+static int __pyx_memviewslice_check_extents(const Py_ssize_t *shape1, const Py_ssize_t *shape2,
+                                            int ndim, int have_gil) {
+    int i;
+    for (i = 0; i < ndim; i++) {
+        if (unlikely(shape1[i] != shape2[i])) {
+            if (have_gil) {
+                PyErr_Format(PyExc_ValueError, "got differing extents in dimension %d (got %zd and %zd)",
+                             i, shape1[i], shape2[i]);
+            } else {
+                PyGILState_STATE gilstate = PyGILState_Ensure();
+                PyErr_Format(PyExc_ValueError, "got differing extents in dimension %d (got %zd and %zd)",
+                             i, shape1[i], shape2[i]);
+                PyGILState_Release(gilstate);
+            }
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+////////// MemviewCompensatedSum.proto //////////
+
+// Python 3.12+ sums floats with the compensated summation of Neumaier,
+// so sum() of memoryviews does the same to give identical results.
+#if PY_VERSION_HEX >= 0x030C0000
+static CYTHON_INLINE void __pyx_compensated_sum_add(double *sum, double *compensation, double x) {
+    double t = *sum + x;
+    if (fabs(*sum) >= fabs(x)) {
+        *compensation += (*sum - t) + x;
+    } else {
+        *compensation += (x - t) + *sum;
+    }
+    *sum = t;
+}
+// Do not turn an infinite or overflowed sum into NaN.
+#define __pyx_compensated_sum_result(sum, compensation) \
+    (((compensation) != 0 && isfinite(compensation)) ? (sum) + (compensation) : (sum))
+#else
+#define __pyx_compensated_sum_add(sum, compensation, x)  (*(sum) += (x))
+#define __pyx_compensated_sum_result(sum, compensation)  ((void) (compensation), (sum))
+#endif
+
+
 ////////// MemviewSliceCheckContig.proto //////////
 
 #define __pyx_memviewslice_is_contig_{{contig_type}}{{ndim}}(slice) \
@@ -50,6 +50,28 @@
 // For use in DL_IMPORT/DL_EXPORT macros.
 #define __PYX_COMMA ,
 
+// With the 'split_output' option, the C files of a module share their module level
+// functions and variables.  The shared variables are defined in the main C file,
+// all other C files of the module define __PYX_SPLIT_PART.
+#ifndef __PYX_SPLIT_OUTPUT
+  #define __PYX_SPLIT_LINKAGE static
+#else
+  #if defined(__GNUC__) && !defined(_WIN32) && !defined(__CYGWIN__)
+    #define __PYX_SPLIT_LINKAGE __attribute__((visibility("hidden")))
+  #else
+    #define __PYX_SPLIT_LINKAGE
+  #endif
+  #ifdef __GNUC__
+    // Each C file only uses a part of the utility code.
+    #pragma GCC diagnostic ignored "-Wunused-function"
+  #endif
+#endif
+#ifdef __PYX_SPLIT_PART
+  #define __PYX_SPLIT_SHARED(decl, init)  extern __PYX_SPLIT_LINKAGE decl
+#else
+  #define __PYX_SPLIT_SHARED(decl, init)  __PYX_SPLIT_LINKAGE decl = init
+#endif
+
 #ifndef PY_LONG_LONG
   #define PY_LONG_LONG LONG_LONG
 #endif
@@ -142,6 +164,8 @@
   #endif
   #undef CYTHON_USE_DICT_VERSIONS
   #define CYTHON_USE_DICT_VERSIONS 0
+  #undef CYTHON_USE_TYPE_VERSION_CACHE
+  #define CYTHON_USE_TYPE_VERSION_CACHE 0
   #undef CYTHON_USE_EXC_INFO_STACK
   #define CYTHON_USE_EXC_INFO_STACK 0
   #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
@@ -231,6 +255,8 @@
   #define CYTHON_USE_AM_SEND 0
   #undef CYTHON_USE_DICT_VERSIONS
   #define CYTHON_USE_DICT_VERSIONS 0
+  #undef CYTHON_USE_TYPE_VERSION_CACHE
+  #define CYTHON_USE_TYPE_VERSION_CACHE 0
   #undef CYTHON_USE_EXC_INFO_STACK
   #define CYTHON_USE_EXC_INFO_STACK 1
   #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
@@ -312,6 +338,8 @@
   #define CYTHON_USE_AM_SEND 0
   #undef CYTHON_USE_DICT_VERSIONS
   #define CYTHON_USE_DICT_VERSIONS 0
+  #undef CYTHON_USE_TYPE_VERSION_CACHE
+  #define CYTHON_USE_TYPE_VERSION_CACHE 0
   #undef CYTHON_USE_EXC_INFO_STACK
   #define CYTHON_USE_EXC_INFO_STACK 0
   #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
@@ -444,6 +472,14 @@
     // and we use static variables with dict versions so it's incompatible with module state
     #define CYTHON_USE_DICT_VERSIONS  (PY_VERSION_HEX < 0x030C00A5 && !CYTHON_USE_MODULE_STATE)
   #endif
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    // Types can be modified concurrently while a cached descriptor is used.
+    #undef CYTHON_USE_TYPE_VERSION_CACHE
+    #define CYTHON_USE_TYPE_VERSION_CACHE 0
+  #elif !defined(CYTHON_USE_TYPE_VERSION_CACHE)
+    // Per call site attribute caches are static variables, as for the dict versions.
+    #define CYTHON_USE_TYPE_VERSION_CACHE  (CYTHON_USE_TYPE_SLOTS && CYTHON_USE_PYTYPE_LOOKUP && !CYTHON_USE_MODULE_STATE)
+  #endif
   #ifndef CYTHON_USE_EXC_INFO_STACK
     #define CYTHON_USE_EXC_INFO_STACK 1
   #endif
@@ -722,25 +758,25 @@ class __Pyx_FakeReference {
     // Cython uses these constants but they are not available in the limited API.
     // Therefore define them as static variables and look them up at module init.
     #ifndef CO_OPTIMIZED
-    static int CO_OPTIMIZED;
+    __PYX_SPLIT_SHARED(int CO_OPTIMIZED, 0);
     #endif
     #ifndef CO_NEWLOCALS
-    static int CO_NEWLOCALS;
+    __PYX_SPLIT_SHARED(int CO_NEWLOCALS, 0);
     #endif
     #ifndef CO_VARARGS
-    static int CO_VARARGS;
+    __PYX_SPLIT_SHARED(int CO_VARARGS, 0);
     #endif
     #ifndef CO_VARKEYWORDS
-    static int CO_VARKEYWORDS;
+    __PYX_SPLIT_SHARED(int CO_VARKEYWORDS, 0);
     #endif
     #ifndef CO_ASYNC_GENERATOR
-    static int CO_ASYNC_GENERATOR;
+    __PYX_SPLIT_SHARED(int CO_ASYNC_GENERATOR, 0);
     #endif
     #ifndef CO_GENERATOR
-    static int CO_GENERATOR;
+    __PYX_SPLIT_SHARED(int CO_GENERATOR, 0);
     #endif
     #ifndef CO_COROUTINE
-    static int CO_COROUTINE;
+    __PYX_SPLIT_SHARED(int CO_COROUTINE, 0);
     #endif
 #else
     #ifndef CO_COROUTINE
@@ -784,8 +820,8 @@ static int __Pyx_init_co_variables(void); /* proto */
 // These can be deduced at runtime and are enough of an optimization that
 // it's worth doing (while still respecting the decision not to add them to
 // the Limited API).
-static unsigned long __Pyx_Runtime_TPFLAGS_SEQUENCE;
-static unsigned long __Pyx_Runtime_TPFLAGS_MAPPING;
+__PYX_SPLIT_SHARED(unsigned long __Pyx_Runtime_TPFLAGS_SEQUENCE, 0);
+__PYX_SPLIT_SHARED(unsigned long __Pyx_Runtime_TPFLAGS_MAPPING, 0);
 #else
 #define __Pyx_Runtime_TPFLAGS_SEQUENCE Py_TPFLAGS_SEQUENCE
 #define __Pyx_Runtime_TPFLAGS_MAPPING Py_TPFLAGS_MAPPING
@@ -1959,7 +1995,7 @@ static void __pyx_insert_code_object(int code_line, __Pyx_CachedCodeObjectType*
 /////////////// GetRuntimeVersion.proto ///////////////
 
 #if __PYX_LIMITED_VERSION_HEX < 0x030b0000
-static unsigned long __Pyx_cached_runtime_version = 0;
+__PYX_SPLIT_SHARED(unsigned long __Pyx_cached_runtime_version, 0);
 
 static void __Pyx_init_runtime_version(void);
 #else
@@ -2067,7 +2103,7 @@ static CYTHON_INLINE int __Pyx_Is_Little_Endian(void)
     void* (*SetupContext)(const char*, Py_ssize_t, const char*);
     void (*FinishContext)(void**);
   } __Pyx_RefNannyAPIStruct;
-  static __Pyx_RefNannyAPIStruct *__Pyx_RefNanny = NULL;
+  __PYX_SPLIT_SHARED(__Pyx_RefNannyAPIStruct *__Pyx_RefNanny, NULL);
   static __Pyx_RefNannyAPIStruct *__Pyx_RefNannyImportAPI(const char *modname); /*proto*/
   #define __Pyx_RefNannyDeclarations void *__pyx_refnanny = NULL;
   #define __Pyx_RefNannySetupContext(name, acquire_gil) \
@@ -2337,9 +2373,9 @@ static void __Pyx_FastGilFuncInit(void);
 #include "pythread.h"
 #include "pystate.h"
 
-static CYTHON_THREAD_LOCAL PyThreadState *__Pyx_FastGil_tcur = NULL;
-static CYTHON_THREAD_LOCAL int __Pyx_FastGil_tcur_depth = 0;
-static int __Pyx_FastGil_autoTLSkey = -1;
+__PYX_SPLIT_SHARED(CYTHON_THREAD_LOCAL PyThreadState *__Pyx_FastGil_tcur, NULL);
+__PYX_SPLIT_SHARED(CYTHON_THREAD_LOCAL int __Pyx_FastGil_tcur_depth, 0);
+__PYX_SPLIT_SHARED(int __Pyx_FastGil_autoTLSkey, -1);
 
 static CYTHON_INLINE void __Pyx_FastGIL_Remember0(void) {
   ++__Pyx_FastGil_tcur_depth;
@@ -1781,6 +1781,198 @@ static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStr(PyObject* obj, PyObject
 }
 #endif
 
+/////////////// TypeVersionTag.proto ///////////////
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+// The version tag changes whenever the type or one of its bases is modified.  0 is not a valid tag.
+#if PY_VERSION_HEX >= 0x030C0000
+#define __Pyx_GetTypeVersionTag(tp)  ((tp)->tp_version_tag)
+#else
+#define __Pyx_GetTypeVersionTag(tp)  \
+    (likely(PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG)) ? (tp)->tp_version_tag : 0)
+#endif
+#endif
+
+/////////////// TypeAttrCache.proto ///////////////
+//@requires: TypeVersionTag
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+// Per call site cache of the attribute lookup in the type of an object, valid as long
+// as the type keeps its version tag.  "descr" is a borrowed reference from the type's MRO,
+// which the type keeps alive until it gets modified and changes its version tag.
+typedef struct {
+    unsigned int type_version;
+    int kind;
+    PyObject *descr;
+    Py_ssize_t offset;
+    // number of misses to skip before refilling, growing with each refill
+    unsigned short backoff;
+    unsigned short refills;
+} __Pyx_TypeAttrCache;
+
+// call tp_getattro
+#define __PYX_TYPE_ATTR_GENERIC       0
+// read an object member at "offset", as for __slots__
+#define __PYX_TYPE_ATTR_SLOT          1
+#define __PYX_TYPE_ATTR_SLOT_OR_NONE  2
+// call the "tp_descr_get" slot of "descr"
+#define __PYX_TYPE_ATTR_DESCR         3
+// like __PYX_TYPE_ATTR_DESCR, but "descr" can be called unbound with the object as first argument
+#define __PYX_TYPE_ATTR_METHOD        4
+// return "descr" itself
+#define __PYX_TYPE_ATTR_CLASS_VALUE   5
+// look up the instance dict at "offset" first
+#define __PYX_TYPE_ATTR_CHECK_DICT    8
+
+#define __Pyx_TypeAttrCache_INIT  {0, __PYX_TYPE_ATTR_GENERIC, NULL, 0, 0, 0}
+#define __PYX_TYPE_ATTR_MAX_BACKOFF_SHIFT  12
+
+static int __Pyx__TypeAttrCache_Fill(PyTypeObject *tp, PyObject *attr_name, __Pyx_TypeAttrCache *cache); /*proto*/
+static CYTHON_INLINE int __Pyx_TypeAttrCache_Lookup(PyTypeObject *tp, PyObject *attr_name, __Pyx_TypeAttrCache *cache); /*proto*/
+static PyObject* __Pyx__TypeAttrCache_GetAttr(PyObject *obj, PyObject *attr_name, int kind, PyObject *descr, Py_ssize_t offset); /*proto*/
+#endif
+
+/////////////// TypeAttrCache ///////////////
+//@requires: PyObjectGetAttrStr
+//@requires: ModuleSetupCode.c::IncludeStructmemberH
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+static int __Pyx__TypeAttrCache_Fill(PyTypeObject *tp, PyObject *attr_name, __Pyx_TypeAttrCache *cache) {
+    PyObject *descr;
+    PyTypeObject *descr_type;
+    unsigned int version;
+    int kind = __PYX_TYPE_ATTR_GENERIC;
+    Py_ssize_t offset = 0;
+
+    if (unlikely(!tp->tp_getattro)) return 0;
+    if (cache->type_version) {
+        // Call sites that see different types (or modified ones) should not pay for
+        // a type lookup on each miss.  Back off exponentially, as CPython's specialisation does.
+        if (cache->refills < __PYX_TYPE_ATTR_MAX_BACKOFF_SHIFT) cache->refills++;
+        cache->backoff = (unsigned short) ((1U << cache->refills) - 1);
+    }
+    // Looking up the name assigns a version tag to the type if it has none yet.
+    descr = _PyType_Lookup(tp, attr_name);
+    version = __Pyx_GetTypeVersionTag(tp);
+    if (unlikely(!version)) return 0;
+
+    if (unlikely(tp->tp_getattro != PyObject_GenericGetAttr)) {
+        descr = NULL;
+    } else if (descr && (descr_type = Py_TYPE(descr))->tp_descr_get && descr_type->tp_descr_set) {
+        // Data descriptors take precedence over the instance dict.
+        kind = __PYX_TYPE_ATTR_DESCR;
+        if (descr_type == &PyMemberDescr_Type) {
+            PyMemberDef *member = ((PyMemberDescrObject*) descr)->d_member;
+            if (!(member->flags & READ_RESTRICTED) && (member->type == T_OBJECT_EX || member->type == T_OBJECT)) {
+                kind = (member->type == T_OBJECT_EX) ? __PYX_TYPE_ATTR_SLOT : __PYX_TYPE_ATTR_SLOT_OR_NONE;
+                offset = member->offset;
+            }
+        }
+    } else if (tp->tp_dictoffset >= 0) {
+        if (descr) {
+            descr_type = Py_TYPE(descr);
+            kind = !descr_type->tp_descr_get ? __PYX_TYPE_ATTR_CLASS_VALUE :
+                PyType_HasFeature(descr_type, Py_TPFLAGS_METHOD_DESCRIPTOR) ? __PYX_TYPE_ATTR_METHOD :
+                __PYX_TYPE_ATTR_DESCR;
+        }
+        if (tp->tp_dictoffset) {
+            // Instance attributes and non-data descriptors are looked up in the instance dict first.
+            kind |= __PYX_TYPE_ATTR_CHECK_DICT;
+            offset = tp->tp_dictoffset;
+        }
+    } else {
+        // Managed or variable sized instance dicts use the generic lookup.
+        descr = NULL;
+    }
+
+    cache->type_version = version;
+    cache->kind = kind;
+    cache->descr = descr;
+    cache->offset = offset;
+    return 1;
+}
+
+static CYTHON_INLINE int __Pyx_TypeAttrCache_Lookup(PyTypeObject *tp, PyObject *attr_name, __Pyx_TypeAttrCache *cache) {
+    unsigned int version = __Pyx_GetTypeVersionTag(tp);
+    if (likely(cache->type_version == version && version)) return 1;
+    if (cache->backoff) {
+        cache->backoff--;
+        return 0;
+    }
+    return __Pyx__TypeAttrCache_Fill(tp, attr_name, cache);
+}
+
+static PyObject* __Pyx__TypeAttrCache_GetAttr(PyObject *obj, PyObject *attr_name, int kind, PyObject *descr, Py_ssize_t offset) {
+    // Takes the cache entry by value since calling into Python code can refill the cache.
+    PyObject *result;
+    if (kind & __PYX_TYPE_ATTR_CHECK_DICT) {
+        PyObject *dict = *(PyObject **) ((char *) obj + offset);
+        if (dict) {
+            int found;
+            // Comparing the keys can run arbitrary code that modifies the type.
+            Py_XINCREF(descr);
+            Py_INCREF(dict);
+            found = __Pyx_PyDict_GetItemRef(dict, attr_name, &result);
+            Py_DECREF(dict);
+            if (!found) {
+                result = __Pyx__TypeAttrCache_GetAttr(obj, attr_name, kind & ~__PYX_TYPE_ATTR_CHECK_DICT, descr, offset);
+            }
+            Py_XDECREF(descr);
+            return result;
+        }
+        kind &= ~__PYX_TYPE_ATTR_CHECK_DICT;
+    }
+
+    switch (kind) {
+        case __PYX_TYPE_ATTR_SLOT:
+        case __PYX_TYPE_ATTR_SLOT_OR_NONE:
+            result = *(PyObject **) ((char *) obj + offset);
+            if (likely(result)) return __Pyx_NewRef(result);
+            if (kind == __PYX_TYPE_ATTR_SLOT_OR_NONE) return __Pyx_NewRef(Py_None);
+            // Let the member descriptor raise the AttributeError.
+            break;
+        case __PYX_TYPE_ATTR_DESCR:
+        case __PYX_TYPE_ATTR_METHOD:
+            Py_INCREF(descr);
+            result = Py_TYPE(descr)->tp_descr_get(descr, obj, (PyObject *) Py_TYPE(obj));
+            Py_DECREF(descr);
+            return result;
+        case __PYX_TYPE_ATTR_CLASS_VALUE:
+            return __Pyx_NewRef(descr);
+    }
+    return Py_TYPE(obj)->tp_getattro(obj, attr_name);
+}
+#endif
+
+
+/////////////// PyObjectGetAttrStrCached.proto ///////////////
+//@requires: PyObjectGetAttrStr
+//@requires: TypeAttrCache
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+#define __Pyx_PyObject_GetAttrStrCached(var, obj, attr_name)  do { \
+    static __Pyx_TypeAttrCache __pyx_type_attr_cache = __Pyx_TypeAttrCache_INIT; \
+    (var) = __Pyx__PyObject_GetAttrStrCached(obj, attr_name, &__pyx_type_attr_cache); \
+} while(0)
+static CYTHON_INLINE PyObject* __Pyx__PyObject_GetAttrStrCached(PyObject* obj, PyObject* attr_name, __Pyx_TypeAttrCache *cache); /*proto*/
+#else
+#define __Pyx_PyObject_GetAttrStrCached(var, obj, attr_name)  (var) = __Pyx_PyObject_GetAttrStr(obj, attr_name)
+#endif
+
+/////////////// PyObjectGetAttrStrCached ///////////////
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+static CYTHON_INLINE PyObject* __Pyx__PyObject_GetAttrStrCached(PyObject* obj, PyObject* attr_name, __Pyx_TypeAttrCache *cache) {
+    PyTypeObject *tp = Py_TYPE(obj);
+    if (unlikely(!__Pyx_TypeAttrCache_Lookup(tp, attr_name, cache)))
+        return __Pyx_PyObject_GetAttrStr(obj, attr_name);
+    if (cache->kind == __PYX_TYPE_ATTR_GENERIC)
+        return tp->tp_getattro(obj, attr_name);
+    return __Pyx__TypeAttrCache_GetAttr(obj, attr_name, cache->kind, cache->descr, cache->offset);
+}
+#endif
+
+
 /////////////// PyObjectDelAttr.proto //////////////////
 
 #if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030d0000
@@ -2415,6 +2607,72 @@ static PyObject *__Pyx_Object_VectorcallMethodKwds(PyObject *name, PyObject *con
 }
 #endif
 
+/////////////// PyObjectVectorcallMethodCached.proto ///////////////
+//@requires: PyObjectVectorcallKwds
+//@requires: PyObjectVectorcallMethodKwds
+//@requires: TypeAttrCache
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+#define __Pyx_Object_VectorcallMethodCached(var, name, args, nargsf, kwnames)  do { \
+    static __Pyx_TypeAttrCache __pyx_type_attr_cache = __Pyx_TypeAttrCache_INIT; \
+    (var) = __Pyx__Object_VectorcallMethodCached(name, args, nargsf, kwnames, &__pyx_type_attr_cache); \
+} while(0)
+static PyObject *__Pyx__Object_VectorcallMethodCached(PyObject *name, PyObject *const *args, size_t nargsf, PyObject *kwnames, __Pyx_TypeAttrCache *cache); /* proto */
+#else
+#define __Pyx_Object_VectorcallMethodCached(var, name, args, nargsf, kwnames)  \
+    (var) = __Pyx_Object_VectorcallMethodKwds(name, args, nargsf, kwnames)
+#endif
+
+/////////////// PyObjectVectorcallMethodCached ///////////////
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+static PyObject *__Pyx__Object_VectorcallMethodCached(PyObject *name, PyObject *const *args, size_t nargsf, PyObject *kwnames, __Pyx_TypeAttrCache *cache) {
+    // Follows PyObject_VectorcallMethod(), using the cached type lookup.
+    PyObject *obj = args[0], *callable, *result;
+    PyTypeObject *tp = Py_TYPE(obj);
+    int kind;
+    if (unlikely(!__Pyx_TypeAttrCache_Lookup(tp, name, cache)))
+        return __Pyx_Object_VectorcallMethodKwds(name, args, nargsf, kwnames);
+    kind = cache->kind;
+    if (kind == __PYX_TYPE_ATTR_GENERIC) {
+        return __Pyx_Object_VectorcallMethodKwds(name, args, nargsf, kwnames);
+    }
+
+    if ((kind & ~__PYX_TYPE_ATTR_CHECK_DICT) == __PYX_TYPE_ATTR_METHOD) {
+        PyObject *method = cache->descr;
+        Py_INCREF(method);
+        if (kind & __PYX_TYPE_ATTR_CHECK_DICT) {
+            PyObject *dict = *(PyObject **) ((char *) obj + cache->offset);
+            if (dict) {
+                int found;
+                Py_INCREF(dict);
+                found = __Pyx_PyDict_GetItemRef(dict, name, &callable);
+                Py_DECREF(dict);
+                if (unlikely(found)) {
+                    // The instance dict shadows the method.
+                    Py_DECREF(method);
+                    if (unlikely(found < 0)) return NULL;
+                    goto call_bound;
+                }
+            }
+        }
+        // Pass "self" as first argument, which leaves no space in front of "args".
+        result = __Pyx_Object_VectorcallKwds(method, args, nargsf & ~((size_t) __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET), kwnames);
+        Py_DECREF(method);
+        return result;
+    }
+
+    callable = __Pyx__TypeAttrCache_GetAttr(obj, name, kind, cache->descr, cache->offset);
+    if (unlikely(!callable)) return NULL;
+call_bound:
+    // "args[0]" can be used by the callee as space in front of the arguments.
+    result = __Pyx_Object_VectorcallKwds(callable, args+1, nargsf-1, kwnames);
+    Py_DECREF(callable);
+    return result;
+}
+#endif
+
+
 /////////////// PyObjectCallMethod0.proto ///////////////
 
 static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethod0(PyObject* obj, PyObject* method_name); /*proto*/
@@ -2773,6 +3031,36 @@ static CYTHON_INLINE int __Pyx_object_dict_version_matches(PyObject* obj, PY_UIN
 }
 #endif
 
+/////////////// TypeVersionOverrideGuard.proto ///////////////
+//@requires: TypeVersionTag
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+// Small direct mapped table of type versions per call site, so that methods of a base class
+// that get called on instances of several subtypes do not evict each other's entry.
+#ifndef __PYX_TP_VERSION_CACHE_SIZE
+#define __PYX_TP_VERSION_CACHE_SIZE 8
+#endif
+#define __Pyx_tp_version_tag_slot(tp_version_tags, tag)  ((tp_version_tags)[(tag) % __PYX_TP_VERSION_CACHE_SIZE])
+#define __Pyx_tp_version_tag_matches(obj, tp_version_tags)  \
+    __Pyx__tp_version_tag_matches(__Pyx_GetTypeVersionTag(Py_TYPE(obj)), tp_version_tags)
+static CYTHON_INLINE int __Pyx__tp_version_tag_matches(unsigned int tag, const unsigned int *tp_version_tags) {
+    return likely(__Pyx_tp_version_tag_slot(tp_version_tags, tag) == tag) && likely(tag);
+}
+static CYTHON_INLINE unsigned int __Pyx_get_cacheable_tp_version_tag(PyObject *obj); /*proto*/
+#endif
+
+/////////////// TypeVersionOverrideGuard ///////////////
+
+#if CYTHON_USE_TYPE_VERSION_CACHE
+// Returns 0 for types whose attribute lookup might not be decided by the type alone.
+static CYTHON_INLINE unsigned int __Pyx_get_cacheable_tp_version_tag(PyObject *obj) {
+    PyTypeObject *tp = Py_TYPE(obj);
+    if (unlikely(tp->tp_dictoffset != 0 || tp->tp_getattro != PyObject_GenericGetAttr))
+        return 0;
+    return __Pyx_GetTypeVersionTag(tp);
+}
+#endif
+
 ////////////// CachedMethodType.module_state_decls ////////////
 
 #if CYTHON_COMPILING_IN_LIMITED_API
@@ -0,0 +1,541 @@
+/////////////// ParallelThreadPool.proto ///////////////
+
+// A pool of persistent worker threads that runs the prange() loops and
+// parallel() blocks compiled with the directive parallel_backend="threads".
+// There is only one pool per process: all Cython modules find it in the
+// shared Cython ABI module, so that concurrent or nested parallel sections
+// never start more threads than the pool has.
+
+#ifndef CYTHON_PARALLEL_THREADS
+  #if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+    #define CYTHON_PARALLEL_THREADS 1
+  #else
+    // Without pthreads, parallel sections run serially in the calling thread.
+    #define CYTHON_PARALLEL_THREADS 0
+  #endif
+#endif
+
+typedef struct __pyx_parallel_team __pyx_parallel_team;
+typedef struct __pyx_parallel_pool __pyx_parallel_pool;
+
+// Runs the iterations of a parallel section in one thread of the team.
+typedef void (*__pyx_parallel_body_func)(void *ctx, __pyx_parallel_team *team, int thread_num);
+
+enum {
+    __Pyx_PARALLEL_SCHEDULE_DEFAULT,  // work stealing
+    __Pyx_PARALLEL_SCHEDULE_STATIC,
+    __Pyx_PARALLEL_SCHEDULE_DYNAMIC,
+    __Pyx_PARALLEL_SCHEDULE_GUIDED
+};
+
+__PYX_SPLIT_SHARED(__pyx_parallel_pool *__pyx_parallel_pool_ptr, NULL);
+
+static int __Pyx_ParallelPool_Init(void); /*proto*/
+static void __Pyx_ParallelPool_Run(__pyx_parallel_body_func body, void *ctx, Py_ssize_t nsteps,
+                                   int num_threads, int schedule, Py_ssize_t chunksize); /*proto*/
+static int __Pyx_ParallelTeam_NextChunk(__pyx_parallel_team *team, int thread_num,
+                                        Py_ssize_t *begin, Py_ssize_t *end); /*proto*/
+CYTHON_UNUSED static void __Pyx_ParallelTeam_Lock(__pyx_parallel_team *team); /*proto*/
+CYTHON_UNUSED static void __Pyx_ParallelTeam_Unlock(__pyx_parallel_team *team); /*proto*/
+CYTHON_UNUSED static int __Pyx_ParallelPool_MaxThreads(int num_threads); /*proto*/
+CYTHON_UNUSED static int __Pyx_ParallelTeam_Size(__pyx_parallel_team *team); /*proto*/
+CYTHON_UNUSED static void __Pyx_ParallelTeam_Barrier(__pyx_parallel_team *team); /*proto*/
+
+/////////////// ParallelThreadPool.init ///////////////
+
+if (likely(__Pyx_ParallelPool_Init() == 0)); else
+// error propagation code is appended automatically
+
+/////////////// ParallelThreadPool ///////////////
+//@requires: CommonStructures.c::FetchSharedCythonModule
+//@requires: Builtins.c::dict_setdefault
+
+#include <stdlib.h>
+#if CYTHON_PARALLEL_THREADS
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+#define __Pyx_PARALLEL_POOL_CAPSULE_NAME "cython_parallel_thread_pool"
+
+// The iterations that one thread of the team works on. Each slot gets its own
+// cache line because the threads update them all the time.
+typedef struct {
+#if CYTHON_PARALLEL_THREADS
+    pthread_mutex_t lock;
+#endif
+    // work stealing: the range [begin, end) that is left, other threads steal its upper half
+    Py_ssize_t begin, end;
+    // static schedule: the start of the next chunk
+    Py_ssize_t next;
+    char padding[64];
+} __pyx_parallel_slot;
+
+struct __pyx_parallel_team {
+    __pyx_parallel_body_func body;
+    void *ctx;
+    Py_ssize_t nsteps;
+    Py_ssize_t chunksize;
+    int schedule;
+    int size;
+#if CYTHON_PARALLEL_THREADS
+    // protects 'next' and the reductions of the threads
+    pthread_mutex_t lock;
+#endif
+    // dynamic and guided schedules: the start of the next chunk
+    Py_ssize_t next;
+    __pyx_parallel_slot *slots;
+    // __Pyx_ParallelTeam_Barrier(), under the team lock
+#if CYTHON_PARALLEL_THREADS
+    pthread_cond_t barrier_passed;
+#endif
+    int barrier_waiting;
+    unsigned long barrier_generation;
+};
+
+struct __pyx_parallel_pool {
+#if CYTHON_PARALLEL_THREADS
+    pthread_mutex_t lock;
+    pthread_cond_t work_available;
+    pthread_cond_t work_done;
+    // set in the worker threads to run nested parallel sections serially
+    pthread_key_t worker_key;
+#endif
+    // default team size, including the calling thread
+    int max_threads;
+    int num_workers;
+    // a team is running, other parallel sections run serially until it finishes
+    int busy;
+    unsigned long generation;
+    __pyx_parallel_team *team;
+    int joined;
+    int running;
+};
+
+static int __Pyx_ParallelPool_DefaultThreads(void) {
+    const char *env_names[] = {"CYTHON_NUM_THREADS", "OMP_NUM_THREADS"};
+    size_t i;
+    for (i = 0; i < sizeof(env_names) / sizeof(env_names[0]); i++) {
+        const char *value = getenv(env_names[i]);
+        if (value) {
+            int num_threads = atoi(value);
+            if (num_threads > 0) return num_threads;
+        }
+    }
+#if CYTHON_PARALLEL_THREADS && defined(_SC_NPROCESSORS_ONLN)
+    {
+        long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        if (num_cpus > 0) return (num_cpus < 1024) ? (int) num_cpus : 1024;
+    }
+#endif
+    return 1;
+}
+
+#if CYTHON_PARALLEL_THREADS
+static void __Pyx_ParallelPool_InitLocks(__pyx_parallel_pool *pool) {
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+}
+
+// Forking only copies the calling thread, so the child has to start new workers.
+static void __Pyx_ParallelPool_AfterFork(void) {
+    __pyx_parallel_pool *pool = __pyx_parallel_pool_ptr;
+    if (!pool) return;
+    __Pyx_ParallelPool_InitLocks(pool);
+    pool->num_workers = 0;
+    pool->busy = 0;
+    pool->team = NULL;
+    pool->joined = pool->running = 0;
+}
+#endif
+
+static __pyx_parallel_pool *__Pyx_ParallelPool_New(void) {
+    __pyx_parallel_pool *pool = (__pyx_parallel_pool *) calloc(1, sizeof(__pyx_parallel_pool));
+    if (unlikely(!pool)) return NULL;
+#if CYTHON_PARALLEL_THREADS
+    if (unlikely(pthread_key_create(&pool->worker_key, NULL) != 0)) {
+        free(pool);
+        return NULL;
+    }
+    __Pyx_ParallelPool_InitLocks(pool);
+#endif
+    pool->max_threads = __Pyx_ParallelPool_DefaultThreads();
+    return pool;
+}
+
+static void __Pyx_ParallelPool_Free(__pyx_parallel_pool *pool) {
+#if CYTHON_PARALLEL_THREADS
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_available);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_key_delete(pool->worker_key);
+#endif
+    free(pool);
+}
+
+static int __Pyx_ParallelPool_Init(void) {
+    PyObject *abi_module, *abi_module_dict, *key = NULL, *capsule = NULL, *shared_capsule;
+    __pyx_parallel_pool *pool = NULL;
+    if (__pyx_parallel_pool_ptr) return 0;
+
+    abi_module = __Pyx_FetchSharedCythonABIModule();
+    if (unlikely(!abi_module)) return -1;
+    abi_module_dict = PyModule_GetDict(abi_module);
+    if (unlikely(!abi_module_dict)) goto bad;
+    key = PyUnicode_FromString(__Pyx_PARALLEL_POOL_CAPSULE_NAME);
+    if (unlikely(!key)) goto bad;
+
+    pool = __Pyx_ParallelPool_New();
+    if (unlikely(!pool)) {
+        PyErr_NoMemory();
+        goto bad;
+    }
+    capsule = PyCapsule_New(pool, __Pyx_PARALLEL_POOL_CAPSULE_NAME, NULL);
+    if (unlikely(!capsule)) goto bad;
+
+    shared_capsule = __Pyx_PyDict_SetDefault(abi_module_dict, key, capsule);
+    if (unlikely(!shared_capsule)) goto bad;
+    if (shared_capsule != capsule) {
+        // Another module created the pool first.
+        __Pyx_ParallelPool_Free(pool);
+        pool = NULL;
+    }
+    __pyx_parallel_pool_ptr = (__pyx_parallel_pool *) PyCapsule_GetPointer(
+        shared_capsule, __Pyx_PARALLEL_POOL_CAPSULE_NAME);
+    Py_DECREF(shared_capsule);
+    if (unlikely(!__pyx_parallel_pool_ptr)) goto bad;
+#if CYTHON_PARALLEL_THREADS
+    if (pool) pthread_atfork(NULL, NULL, __Pyx_ParallelPool_AfterFork);
+#endif
+
+    Py_DECREF(capsule);
+    Py_DECREF(key);
+    Py_DECREF(abi_module);
+    return 0;
+
+bad:
+    if (capsule) {
+        // The capsule does not own the pool.
+        Py_DECREF(capsule);
+    }
+    if (pool) __Pyx_ParallelPool_Free(pool);
+    Py_XDECREF(key);
+    Py_DECREF(abi_module);
+    return -1;
+}
+
+static void __Pyx_ParallelTeam_Lock(__pyx_parallel_team *team) {
+#if CYTHON_PARALLEL_THREADS
+    if (team->size > 1) pthread_mutex_lock(&team->lock);
+#else
+    CYTHON_UNUSED_VAR(team);
+#endif
+}
+
+static void __Pyx_ParallelTeam_Unlock(__pyx_parallel_team *team) {
+#if CYTHON_PARALLEL_THREADS
+    if (team->size > 1) pthread_mutex_unlock(&team->lock);
+#else
+    CYTHON_UNUSED_VAR(team);
+#endif
+}
+
+static int __Pyx_ParallelTeam_Size(__pyx_parallel_team *team) {
+    return team->size;
+}
+
+// Waits until all threads of the team have reached the barrier.
+static void __Pyx_ParallelTeam_Barrier(__pyx_parallel_team *team) {
+#if CYTHON_PARALLEL_THREADS
+    unsigned long generation;
+    if (team->size == 1) return;
+    pthread_mutex_lock(&team->lock);
+    generation = team->barrier_generation;
+    if (++team->barrier_waiting == team->size) {
+        team->barrier_waiting = 0;
+        team->barrier_generation++;
+        pthread_cond_broadcast(&team->barrier_passed);
+    } else {
+        while (team->barrier_generation == generation) {
+            pthread_cond_wait(&team->barrier_passed, &team->lock);
+        }
+    }
+    pthread_mutex_unlock(&team->lock);
+#else
+    CYTHON_UNUSED_VAR(team);
+#endif
+}
+
+// An upper bound for the size of the team that __Pyx_ParallelPool_Run() starts.
+static int __Pyx_ParallelPool_MaxThreads(int num_threads) {
+#if CYTHON_PARALLEL_THREADS
+    __pyx_parallel_pool *pool = __pyx_parallel_pool_ptr;
+    if (pool && !pthread_getspecific(pool->worker_key)) {
+        return (num_threads > 0) ? num_threads : pool->max_threads;
+    }
+#else
+    CYTHON_UNUSED_VAR(num_threads);
+#endif
+    return 1;
+}
+
+static int __Pyx_ParallelTeam_NextChunk(__pyx_parallel_team *team, int thread_num,
+                                        Py_ssize_t *begin, Py_ssize_t *end) {
+    __pyx_parallel_slot *slot = &team->slots[thread_num];
+    Py_ssize_t nsteps = team->nsteps, chunksize = team->chunksize;
+
+    switch (team->schedule) {
+    case __Pyx_PARALLEL_SCHEDULE_STATIC:
+        // Only this thread uses its slot.
+        if (slot->next >= slot->end) return 0;
+        *begin = slot->next;
+        if (slot->end - *begin > chunksize) {
+            Py_ssize_t stride = chunksize * team->size;
+            *end = *begin + chunksize;
+            slot->next = (slot->end - *begin > stride) ? *begin + stride : slot->end;
+        } else {
+            *end = slot->next = slot->end;
+        }
+        return 1;
+
+#if CYTHON_PARALLEL_THREADS
+    case __Pyx_PARALLEL_SCHEDULE_DYNAMIC:
+    case __Pyx_PARALLEL_SCHEDULE_GUIDED: {
+        Py_ssize_t remaining;
+        pthread_mutex_lock(&team->lock);
+        remaining = nsteps - team->next;
+        if (remaining <= 0) {
+            pthread_mutex_unlock(&team->lock);
+            return 0;
+        }
+        if (team->schedule == __Pyx_PARALLEL_SCHEDULE_GUIDED && remaining / (2 * team->size) > chunksize) {
+            chunksize = remaining / (2 * team->size);
+        }
+        *begin = team->next;
+        *end = team->next = *begin + ((remaining > chunksize) ? chunksize : remaining);
+        pthread_mutex_unlock(&team->lock);
+        return 1;
+    }
+
+    default: {
+        // Work stealing: take chunks from the own range, and when it is used up,
+        // take over the upper half of the range of another thread.
+        int i;
+        for (;;) {
+            pthread_mutex_lock(&slot->lock);
+            if (slot->begin < slot->end) {
+                *begin = slot->begin;
+                *end = slot->begin = (slot->end - *begin > chunksize) ? *begin + chunksize : slot->end;
+                pthread_mutex_unlock(&slot->lock);
+                return 1;
+            }
+            pthread_mutex_unlock(&slot->lock);
+
+            for (i = 1; i < team->size; i++) {
+                __pyx_parallel_slot *victim = &team->slots[(thread_num + i) % team->size];
+                Py_ssize_t stolen_begin, stolen_end;
+                pthread_mutex_lock(&victim->lock);
+                stolen_end = victim->end;
+                stolen_begin = victim->begin + (stolen_end - victim->begin) / 2;
+                if (stolen_begin < stolen_end) {
+                    victim->end = stolen_begin;
+                }
+                pthread_mutex_unlock(&victim->lock);
+                if (stolen_begin < stolen_end) {
+                    pthread_mutex_lock(&slot->lock);
+                    slot->begin = stolen_begin;
+                    slot->end = stolen_end;
+                    pthread_mutex_unlock(&slot->lock);
+                    break;
+                }
+            }
+            if (i == team->size) {
+                // Ranges that other threads just stole are not visible here,
+                // but the thieves run them themselves.
+                return 0;
+            }
+        }
+    }
+#else
+    default:
+        CYTHON_UNUSED_VAR(nsteps);
+        return 0;
+#endif
+    }
+}
+
+#if CYTHON_PARALLEL_THREADS
+static void *__Pyx_ParallelPool_Worker(void *arg) {
+    __pyx_parallel_pool *pool = (__pyx_parallel_pool *) arg;
+    unsigned long seen_generation = 0;
+    pthread_setspecific(pool->worker_key, pool);
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        __pyx_parallel_team *team = pool->team;
+        if (team && pool->generation != seen_generation && pool->joined < team->size - 1) {
+            int thread_num = ++pool->joined;
+            seen_generation = pool->generation;
+            pthread_mutex_unlock(&pool->lock);
+
+            team->body(team->ctx, team, thread_num);
+
+            pthread_mutex_lock(&pool->lock);
+            if (--pool->running == 0) pthread_cond_signal(&pool->work_done);
+        } else {
+            // Nothing to do, or the team is complete without this thread.
+            if (team) seen_generation = pool->generation;
+            pthread_cond_wait(&pool->work_available, &pool->lock);
+        }
+    }
+    return NULL;
+}
+
+// Call with the pool lock held. Returns the number of workers that are available.
+static int __Pyx_ParallelPool_StartWorkers(__pyx_parallel_pool *pool, int num_workers) {
+    if (pool->num_workers < num_workers) {
+        pthread_attr_t attr;
+        sigset_t all_signals, old_signals;
+        if (pthread_attr_init(&attr) != 0) return pool->num_workers;
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        // Signals are for the Python threads, workers inherit this mask.
+        sigfillset(&all_signals);
+        pthread_sigmask(SIG_SETMASK, &all_signals, &old_signals);
+        while (pool->num_workers < num_workers) {
+            pthread_t thread;
+            if (pthread_create(&thread, &attr, __Pyx_ParallelPool_Worker, pool) != 0) break;
+            pool->num_workers++;
+        }
+        pthread_sigmask(SIG_SETMASK, &old_signals, NULL);
+        pthread_attr_destroy(&attr);
+    }
+    return pool->num_workers;
+}
+#endif
+
+static void __Pyx_ParallelTeam_InitSlots(__pyx_parallel_team *team) {
+    Py_ssize_t block = team->nsteps / team->size, extra = team->nsteps % team->size;
+    int t;
+    for (t = 0; t < team->size; t++) {
+        __pyx_parallel_slot *slot = &team->slots[t];
+        slot->begin = block * t + ((t < extra) ? t : extra);
+        slot->end = slot->begin + block + ((t < extra) ? 1 : 0);
+        if (team->schedule == __Pyx_PARALLEL_SCHEDULE_STATIC && team->chunksize < team->nsteps) {
+            // round robin chunks
+            slot->next = (t < (team->nsteps + team->chunksize - 1) / team->chunksize) ?
+                team->chunksize * t : team->nsteps;
+            slot->end = team->nsteps;
+        } else {
+            slot->next = slot->begin;
+        }
+#if CYTHON_PARALLEL_THREADS
+        if (team->size > 1) pthread_mutex_init(&slot->lock, NULL);
+#endif
+    }
+}
+
+// 'nsteps' < 0 runs the body once in each thread of the team, for parallel() blocks.
+// 'num_threads' <= 0 uses the default team size of the pool.
+static void __Pyx_ParallelPool_Run(__pyx_parallel_body_func body, void *ctx, Py_ssize_t nsteps,
+                                   int num_threads, int schedule, Py_ssize_t chunksize) {
+    __pyx_parallel_pool *pool = __pyx_parallel_pool_ptr;
+    __pyx_parallel_team team;
+    __pyx_parallel_slot serial_slot;
+    int size = 1;
+    if (nsteps == 0) return;
+
+    team.body = body;
+    team.ctx = ctx;
+    team.schedule = schedule;
+    team.next = 0;
+    team.slots = &serial_slot;
+    team.barrier_waiting = 0;
+    team.barrier_generation = 0;
+
+#if CYTHON_PARALLEL_THREADS
+    if (pool && !pthread_getspecific(pool->worker_key)) {
+        size = (num_threads > 0) ? num_threads : pool->max_threads;
+        if (nsteps > 0 && nsteps < size) size = (int) nsteps;
+    }
+    if (size > 1) {
+        pthread_mutex_lock(&pool->lock);
+        if (pool->busy) {
+            size = 1;
+        } else {
+            int num_workers = __Pyx_ParallelPool_StartWorkers(pool, size - 1);
+            if (num_workers < size - 1) size = num_workers + 1;
+            pool->busy = (size > 1);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+    if (size > 1) {
+        team.slots = (__pyx_parallel_slot *) malloc(size * sizeof(__pyx_parallel_slot));
+        if (unlikely(!team.slots)) {
+            team.slots = &serial_slot;
+            pthread_mutex_lock(&pool->lock);
+            pool->busy = 0;
+            pthread_mutex_unlock(&pool->lock);
+            size = 1;
+        }
+    }
+#else
+    CYTHON_UNUSED_VAR(pool);
+    CYTHON_UNUSED_VAR(num_threads);
+#endif
+
+    team.size = size;
+    team.nsteps = (nsteps < 0) ? size : nsteps;
+    if (nsteps < 0 || size == 1) {
+        team.schedule = __Pyx_PARALLEL_SCHEDULE_STATIC;
+        team.chunksize = (nsteps < 0) ? 1 : team.nsteps;
+    } else if (chunksize > 0) {
+        team.chunksize = chunksize;
+    } else if (schedule == __Pyx_PARALLEL_SCHEDULE_STATIC) {
+        // one block per thread
+        team.chunksize = team.nsteps;
+    } else if (schedule == __Pyx_PARALLEL_SCHEDULE_DEFAULT) {
+        // small enough to balance the load, large enough to keep the locking cheap
+        team.chunksize = team.nsteps / (32 * (Py_ssize_t) size);
+        if (team.chunksize < 1) team.chunksize = 1;
+    } else {
+        team.chunksize = 1;
+    }
+    __Pyx_ParallelTeam_InitSlots(&team);
+
+    if (size == 1) {
+        body(ctx, &team, 0);
+        return;
+    }
+
+#if CYTHON_PARALLEL_THREADS
+    pthread_mutex_init(&team.lock, NULL);
+    pthread_cond_init(&team.barrier_passed, NULL);
+    pthread_mutex_lock(&pool->lock);
+    pool->team = &team;
+    pool->joined = 0;
+    pool->running = size - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+
+    body(ctx, &team, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->running > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pool->team = NULL;
+    pool->busy = 0;
+    pthread_mutex_unlock(&pool->lock);
+
+    {
+        int t;
+        for (t = 0; t < size; t++) pthread_mutex_destroy(&team.slots[t].lock);
+    }
+    pthread_cond_destroy(&team.barrier_passed);
+    pthread_mutex_destroy(&team.lock);
+    free(team.slots);
+#endif
+}
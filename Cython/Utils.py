@@ -127,6 +127,16 @@ def replace_suffix(path, newsuf):
     return base + newsuf
 
 
+def split_output_files(c_file, split_output):
+    """
+    Returns the internal header and the list of additional C files
+    that the 'split_output' option generates next to the main C file.
+    """
+    base, ext = os.path.splitext(c_file)
+    parts = ['%s.part%d%s' % (base, i, ext) for i in range(1, split_output)]
+    return base + '.parts.h', parts
+
+
 def open_new_file(path):
     if os.path.exists(path):
         # Make sure to create a new file here so we can
@@ -138,6 +148,22 @@ def open_new_file(path):
     return open(path, "w", encoding="UTF-8")
 
 
+def write_file_if_changed(path, content):
+    """
+    Writes the content into a new file at path, unless the file already
+    contains exactly that content.  Returns True if the file was written.
+    """
+    try:
+        with open(path, encoding="UTF-8") as f:
+            if f.read() == content:
+                return False
+    except (OSError, UnicodeDecodeError):
+        pass
+    with open_new_file(path) as f:
+        f.write(content)
+    return True
+
+
 def castrate_file(path, st):
     #  Remove junk contents from an output file after a
     #  failed compilation.
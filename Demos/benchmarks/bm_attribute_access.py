@@ -0,0 +1,117 @@
+import cython
+
+import time
+
+
+class Point:
+    scale = 2
+
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+    def norm1(self):
+        return abs(self.x) + abs(self.y)
+
+
+class SlottedPoint:
+    __slots__ = ('x', 'y')
+
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+    def norm1(self):
+        return abs(self.x) + abs(self.y)
+
+
+class Point3D(Point):
+    def norm1(self):
+        return abs(self.x) + abs(self.y) + 1
+
+
+@cython.cclass
+class ExtPoint:
+    _x: object
+    _y: object
+
+    def __init__(self, x, y):
+        self._x = x
+        self._y = y
+
+    @property
+    def x(self):
+        return self._x
+
+    @property
+    def y(self):
+        return self._y
+
+    def norm1(self):
+        return abs(self._x) + abs(self._y)
+
+
+def _sum_attributes(points, number: cython.int, timer):
+    s = 0
+    t = timer()
+    for _ in range(number):
+        for p in points:
+            s += p.x + p.y
+    t = timer() - t
+    return t
+
+
+def _sum_methods(points, number: cython.int, timer):
+    s = 0
+    t = timer()
+    for _ in range(number):
+        for p in points:
+            s += p.norm1()
+    t = timer() - t
+    return t
+
+
+def _points(cls):
+    return [cls(i, -i) for i in range(10)]
+
+
+def _bench(runner, *classes):
+    points = [p for cls in classes for p in _points(cls)]
+
+    def bench(number: cython.int, timer):
+        return runner(points, number, timer)
+    return bench
+
+
+def get_benchmarks():
+    return {
+        'attr_instance': _bench(_sum_attributes, Point),
+        'attr_slots': _bench(_sum_attributes, SlottedPoint),
+        'attr_property': _bench(_sum_attributes, ExtPoint),
+        'attr_polymorphic': _bench(_sum_attributes, Point, Point3D),
+        'method_instance': _bench(_sum_methods, Point),
+        'method_slots': _bench(_sum_methods, SlottedPoint),
+        'method_cclass': _bench(_sum_methods, ExtPoint),
+        'method_polymorphic': _bench(_sum_methods, Point, Point3D),
+    }
+
+
+def run_benchmark(repeat=True, scale=100):
+    from util import repeat_to_accuracy, scale_subbenchmarks
+
+    benchmarks = get_benchmarks()
+
+    timings = {
+        name: func(100, time.perf_counter)
+        for name, func in benchmarks.items()
+    }
+    scales = scale_subbenchmarks(timings, scale)
+
+    collected_timings = {}
+
+    for name, func in benchmarks.items():
+        collected_timings[name] = repeat_to_accuracy(
+            func, scale=scales[name], repeat=repeat)[0]
+
+    for name, timings in collected_timings.items():
+        print(f"{name}: {timings}")
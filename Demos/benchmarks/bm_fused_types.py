@@ -1,5 +1,6 @@
 import cython
 
+from array import array
 import time
 
 
@@ -89,11 +90,47 @@ def _call_fused_func_args_3(number: cython.int, timer):
     return t
 
 
+numeric = cython.fused_type(cython.int, cython.double)
+numeric2 = cython.fused_type(cython.int, cython.double)
+
+
+def _fused_func_numeric(x: numeric, y: numeric2):
+    return x
+
+
+def _call_fused_func_numeric(number: cython.int, timer):
+    # Calls with the same argument types, as in a loop over a numeric API.
+    func = _fused_func_numeric
+
+    t = timer()
+    for _ in range(number):
+        func(1.5, 2)
+    t = timer() - t
+    return t
+
+
+def _fused_func_buffer(values: cython.floating[:]):
+    return len(values)
+
+
+def _call_fused_func_buffer(number: cython.int, timer):
+    func = _fused_func_buffer
+    values = array('d', [1.5] * 4)
+
+    t = timer()
+    for _ in range(number):
+        func(values)
+    t = timer() - t
+    return t
+
+
 def get_benchmarks():
     return {
         'fused_args_1': _call_fused_func_args_1,
         'fused_args_2': _call_fused_func_args_2,
         'fused_args_3': _call_fused_func_args_3,
+        'fused_numeric': _call_fused_func_numeric,
+        'fused_buffer': _call_fused_func_buffer,
     }
 
 
@@ -0,0 +1,103 @@
+import cython
+
+import time
+
+
+def _wide_func(
+        host=None, port=None, user=None, password=None, timeout=None, retries=None,
+        verbose=None, debug=None, encoding=None, errors=None, buffer_size=None, max_size=None,
+        min_size=None, cache_size=None, cache_dir=None, log_file=None, log_level=None, name=None,
+        alpha=None, beta=None, gamma=None, delta=None, epsilon=None, zeta=None,
+        eta=None, theta=None, iota=None, kappa=None, lambda_=None, mu=None, nu=None, xi=None):
+    return host
+
+
+@cython.cclass
+class WideConfig:
+    host: object
+
+    def __init__(
+            self, host=None, port=None, user=None, password=None, timeout=None, retries=None,
+            verbose=None, debug=None, encoding=None, errors=None, buffer_size=None, max_size=None,
+            min_size=None, cache_size=None, cache_dir=None, log_file=None, log_level=None, name=None,
+            alpha=None, beta=None, gamma=None, delta=None, epsilon=None, zeta=None,
+            eta=None, theta=None, iota=None, kappa=None, lambda_=None, mu=None, nu=None, xi=None):
+        self.host = host
+
+
+def _narrow_func(a=None, b=None, c=None):
+    return a
+
+
+def _call_wide_func(number: cython.int, timer):
+    # Keywords from the end of the signature take the longest search without a hash table.
+    func = _wide_func
+
+    t = timer()
+    for _ in range(number):
+        func(host=1, nu=2, xi=3, mu=4)
+    t = timer() - t
+    return t
+
+
+def _call_wide_func_dynamic_names(number: cython.int, timer):
+    # Keyword names that are not interned cannot be matched by identity.
+    func = _wide_func
+    kwargs = {''.join(['n', 'u']): 1, ''.join(['x', 'i']): 2, ''.join(['m', 'u']): 3}
+
+    t = timer()
+    for _ in range(number):
+        func(**kwargs)
+    t = timer() - t
+    return t
+
+
+def _call_wide_init(number: cython.int, timer):
+    # Extension type constructors receive their keyword arguments as a dict.
+    cls = WideConfig
+
+    t = timer()
+    for _ in range(number):
+        cls(host=1, nu=2, xi=3, mu=4)
+    t = timer() - t
+    return t
+
+
+def _call_narrow_func(number: cython.int, timer):
+    func = _narrow_func
+
+    t = timer()
+    for _ in range(number):
+        func(c=1, b=2)
+    t = timer() - t
+    return t
+
+
+def get_benchmarks():
+    return {
+        'kwargs_wide': _call_wide_func,
+        'kwargs_wide_dynamic': _call_wide_func_dynamic_names,
+        'kwargs_wide_init': _call_wide_init,
+        'kwargs_narrow': _call_narrow_func,
+    }
+
+
+def run_benchmark(repeat=True, scale=100):
+    from util import repeat_to_accuracy, scale_subbenchmarks
+
+    benchmarks = get_benchmarks()
+
+    timings = {
+        name: func(1000, time.perf_counter)
+        for name, func in benchmarks.items()
+    }
+    scales = scale_subbenchmarks(timings, scale)
+
+    collected_timings = {}
+
+    for name, func in benchmarks.items():
+        collected_timings[name] = repeat_to_accuracy(
+            func, scale=scales[name], repeat=repeat)[0]
+
+    for name, timings in collected_timings.items():
+        print(f"{name}: {timings}")
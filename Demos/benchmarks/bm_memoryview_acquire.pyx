@@ -0,0 +1,85 @@
+# cython: auto_pickle=False
+
+cimport cython
+
+from array import array
+import collections
+import time
+
+
+### Converting the same kinds of buffers to typed memoryviews over and over again,
+### which validates the buffer format string on each conversion.
+
+cdef double _first_double(double[:] values):
+    return values[0]
+
+
+def bm_memoryview_acquire_double(scale, timer=time.perf_counter):
+    values = array('d', [1.5] * 10)
+    cdef long i, n = scale * 100
+    t = timer()
+    for i in range(n):
+        _first_double(values)
+    t = timer() - t
+    return t
+
+
+cdef int _first_int_2d(const int[:, ::1] values):
+    return values[0, 0]
+
+
+def bm_memoryview_acquire_2d(scale, timer=time.perf_counter):
+    values = memoryview(array('i', range(12))).cast('B').cast('i', [3, 4])
+    cdef long i, n = scale * 100
+    t = timer()
+    for i in range(n):
+        _first_int_2d(values)
+    t = timer() - t
+    return t
+
+
+cdef struct Point:
+    double x
+    double y
+    int flags
+
+
+cdef double _first_x(Point[:] points):
+    return points[0].x
+
+
+def bm_memoryview_acquire_struct(scale, timer=time.perf_counter):
+    points = cython.view.array(shape=(10,), itemsize=sizeof(Point), format="T{d:x:d:y:i:flags:}")
+    cdef long i, n = scale * 100
+    t = timer()
+    for i in range(n):
+        _first_x(points)
+    t = timer() - t
+    return t
+
+
+#### main ####
+
+def time_benchmarks(scale):
+    timings = {}
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        timings[name] = func(scale)
+    return timings
+
+
+def run_benchmark(repeat: bool, scale=1000):
+    from util import repeat_to_accuracy, scale_subbenchmarks
+
+    scales = scale_subbenchmarks(time_benchmarks(10), scale)
+
+    collected_timings = collections.defaultdict(list)
+
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        collected_timings[name] = repeat_to_accuracy(func, scale=scales[name], repeat=repeat, scale_to=scale)[0]
+
+    for name, timings in collected_timings.items():
+        print(f"{name}: {timings}")
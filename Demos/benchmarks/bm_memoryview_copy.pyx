@@ -0,0 +1,88 @@
+# cython: auto_pickle=False
+
+cimport cython
+
+import collections
+import time
+
+
+### Copying 2-D memoryviews between different memory layouts.
+
+cdef double[:, ::1] _new_c_array(Py_ssize_t rows, Py_ssize_t cols):
+    cdef double[:, ::1] values = cython.view.array(shape=(rows, cols), itemsize=sizeof(double), format='d')
+    values[:, :] = 1.5
+    return values
+
+
+cdef double[::1, :] _new_f_array(Py_ssize_t rows, Py_ssize_t cols):
+    return cython.view.array(shape=(rows, cols), itemsize=sizeof(double), format='d', mode='fortran')
+
+
+def bm_memoryview_copy_c_to_fortran(scale, timer=time.perf_counter):
+    cdef double[:, ::1] src = _new_c_array(1000, 1000)
+    cdef double[::1, :] dst = _new_f_array(1000, 1000)
+    cdef long i, n = scale
+    t = timer()
+    for i in range(n):
+        dst[:, :] = src
+    t = timer() - t
+    return t
+
+
+def bm_memoryview_copy_transpose(scale, timer=time.perf_counter):
+    cdef double[:, ::1] src = _new_c_array(1000, 1000)
+    cdef double[:, ::1] dst = _new_c_array(1000, 1000)
+    cdef long i, n = scale
+    t = timer()
+    for i in range(n):
+        dst[:, :] = src.T
+    t = timer() - t
+    return t
+
+
+def bm_memoryview_copy_fortran(scale, timer=time.perf_counter):
+    cdef double[:, ::1] src = _new_c_array(1000, 1000)
+    cdef long i, n = scale
+    t = timer()
+    for i in range(n):
+        src.copy_fortran()
+    t = timer() - t
+    return t
+
+
+def bm_memoryview_copy_strided_rows(scale, timer=time.perf_counter):
+    cdef double[:, ::1] src = _new_c_array(2000, 1000)
+    cdef double[:, ::1] dst = _new_c_array(1000, 1000)
+    cdef long i, n = scale
+    t = timer()
+    for i in range(n):
+        dst[:, :] = src[::2, :]
+    t = timer() - t
+    return t
+
+
+#### main ####
+
+def time_benchmarks(scale):
+    timings = {}
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        timings[name] = func(scale)
+    return timings
+
+
+def run_benchmark(repeat: bool, scale=1000):
+    from util import repeat_to_accuracy, scale_subbenchmarks
+
+    scales = scale_subbenchmarks(time_benchmarks(10), scale)
+
+    collected_timings = collections.defaultdict(list)
+
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        collected_timings[name] = repeat_to_accuracy(func, scale=scales[name], repeat=repeat, scale_to=scale)[0]
+
+    for name, timings in collected_timings.items():
+        print(f"{name}: {timings}")
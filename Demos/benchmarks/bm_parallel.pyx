@@ -0,0 +1,166 @@
+# cython: auto_pickle=False
+# cython: parallel_backend=threads
+
+cimport cython
+from cython.parallel cimport prange
+
+import collections
+import time
+
+
+### Loops with the same cost for each iteration.
+
+cdef double _sum_of_squares(double[::1] values) noexcept nogil:
+    cdef Py_ssize_t i
+    cdef double total = 0
+    for i in prange(values.shape[0]):
+        total += values[i] * values[i]
+    return total
+
+
+def bm_prange_uniform(scale, timer=time.perf_counter):
+    cdef double[::1] values = cython.view.array(shape=(100_000,), itemsize=sizeof(double), format='d')
+    values[:] = 1.5
+    cdef long i, n = scale
+    t = timer()
+    with nogil:
+        for i in range(n):
+            _sum_of_squares(values)
+    t = timer() - t
+    return t
+
+
+### Loops that pass a row of a shared memoryview to a function in each iteration.
+
+cdef double _row_sum(const double[:] row) noexcept nogil:
+    cdef Py_ssize_t j
+    cdef double total = 0
+    for j in range(row.shape[0]):
+        total += row[j]
+    return total
+
+
+cdef double _sum_of_rows(const double[:, ::1] values) noexcept nogil:
+    cdef Py_ssize_t i
+    cdef double total = 0
+    for i in prange(values.shape[0]):
+        total += _row_sum(values[i, :])
+    return total
+
+
+def bm_prange_rows(scale, timer=time.perf_counter):
+    cdef double[:, ::1] values = cython.view.array(shape=(10_000, 4), itemsize=sizeof(double), format='d')
+    values[:, :] = 1.5
+    cdef long i, n = scale
+    t = timer()
+    with nogil:
+        for i in range(n):
+            _sum_of_rows(values)
+    t = timer() - t
+    return t
+
+
+### Loops where the cost of the iterations grows with the index, so that
+### threads with an equal number of iterations finish at different times.
+
+cdef double _triangle_default(long n) noexcept nogil:
+    cdef long i, j
+    cdef double total = 0
+    for i in prange(n):
+        for j in range(i):
+            total += j * 0.5
+    return total
+
+
+cdef double _triangle_static(long n) noexcept nogil:
+    cdef long i, j
+    cdef double total = 0
+    for i in prange(n, schedule='static'):
+        for j in range(i):
+            total += j * 0.5
+    return total
+
+
+cdef double _triangle_dynamic(long n) noexcept nogil:
+    cdef long i, j
+    cdef double total = 0
+    for i in prange(n, schedule='dynamic'):
+        for j in range(i):
+            total += j * 0.5
+    return total
+
+
+def bm_prange_uneven_default(scale, timer=time.perf_counter):
+    cdef long i, n = scale
+    t = timer()
+    with nogil:
+        for i in range(n):
+            _triangle_default(1000)
+    t = timer() - t
+    return t
+
+
+def bm_prange_uneven_static(scale, timer=time.perf_counter):
+    cdef long i, n = scale
+    t = timer()
+    with nogil:
+        for i in range(n):
+            _triangle_static(1000)
+    t = timer() - t
+    return t
+
+
+def bm_prange_uneven_dynamic(scale, timer=time.perf_counter):
+    cdef long i, n = scale
+    t = timer()
+    with nogil:
+        for i in range(n):
+            _triangle_dynamic(1000)
+    t = timer() - t
+    return t
+
+
+### Short loops, where starting the threads dominates.
+
+cdef long _short_loop(long n) noexcept nogil:
+    cdef long i, total = 0
+    for i in prange(n):
+        total += i
+    return total
+
+
+def bm_prange_short(scale, timer=time.perf_counter):
+    cdef long i, n = scale
+    t = timer()
+    with nogil:
+        for i in range(n):
+            _short_loop(100)
+    t = timer() - t
+    return t
+
+
+#### main ####
+
+def time_benchmarks(scale):
+    timings = {}
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        timings[name] = func(scale)
+    return timings
+
+
+def run_benchmark(repeat: bool, scale=1000):
+    from util import repeat_to_accuracy, scale_subbenchmarks
+
+    scales = scale_subbenchmarks(time_benchmarks(10), scale)
+
+    collected_timings = collections.defaultdict(list)
+
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        collected_timings[name] = repeat_to_accuracy(func, scale=scales[name], repeat=repeat, scale_to=scale)[0]
+
+    for name, timings in collected_timings.items():
+        print(f"{name}: {timings}")
@@ -0,0 +1,71 @@
+# cython: auto_pickle=False
+
+cimport cython
+
+import collections
+import time
+
+
+### Creating small, short-lived cython.view.array scratch buffers in a loop.
+
+cdef double _fill_scratch(object scratch):
+    cdef double[:] values = scratch
+    cdef Py_ssize_t i
+    for i in range(values.shape[0]):
+        values[i] = i
+    return values[values.shape[0] - 1]
+
+
+def bm_view_array_scratch(scale, timer=time.perf_counter):
+    cdef long i, n = scale * 100
+    t = timer()
+    for i in range(n):
+        _fill_scratch(cython.view.array(shape=(64,), itemsize=sizeof(double), format='d'))
+    t = timer() - t
+    return t
+
+
+def bm_view_array_scratch_pooled(scale, timer=time.perf_counter):
+    cdef long i, n = scale * 100
+    t = timer()
+    for i in range(n):
+        _fill_scratch(cython.view.array(shape=(64,), itemsize=sizeof(double), format='d', pooled=True))
+    t = timer() - t
+    return t
+
+
+def bm_view_array_scratch_aligned(scale, timer=time.perf_counter):
+    cdef long i, n = scale * 100
+    t = timer()
+    for i in range(n):
+        _fill_scratch(cython.view.array(shape=(64,), itemsize=sizeof(double), format='d',
+                                        alignment=64, pooled=True))
+    t = timer() - t
+    return t
+
+
+#### main ####
+
+def time_benchmarks(scale):
+    timings = {}
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        timings[name] = func(scale)
+    return timings
+
+
+def run_benchmark(repeat: bool, scale=1000):
+    from util import repeat_to_accuracy, scale_subbenchmarks
+
+    scales = scale_subbenchmarks(time_benchmarks(10), scale)
+
+    collected_timings = collections.defaultdict(list)
+
+    for name, func in globals().items():
+        if not name.startswith('bm_'):
+            continue
+        collected_timings[name] = repeat_to_accuracy(func, scale=scales[name], repeat=repeat, scale_to=scale)[0]
+
+    for name, timings in collected_timings.items():
+        print(f"{name}: {timings}")
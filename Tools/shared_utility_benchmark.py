@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+
+"""
+Compare the binary size and the C compile time of a set of extension modules
+when each module contains its own copy of Cython's utility code with a build
+that moves the utility code into a shared module of the package.
+
+Usage: shared_utility_benchmark.py [-j N] [SOURCE ...]
+
+Defaults to the benchmark modules in "Demos/benchmarks/".
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import sys
+import tempfile
+import time
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+sys.path.insert(0, REPO_DIR)
+
+PACKAGE = 'bench_pkg'
+SHARED_MODULE = PACKAGE + '._cyutility'
+
+
+def build(sources, work_dir, shared, parallel):
+    from setuptools import Distribution
+    from Cython.Build import cythonize
+
+    pkg_dir = os.path.join(work_dir, PACKAGE)
+    os.makedirs(pkg_dir)
+    open(os.path.join(pkg_dir, '__init__.py'), 'w').close()
+    for source in sources:
+        shutil.copy(source, pkg_dir)
+        pxd = os.path.splitext(source)[0] + '.pxd'
+        if os.path.exists(pxd):
+            shutil.copy(pxd, pkg_dir)
+
+    cwd = os.getcwd()
+    os.chdir(work_dir)
+    try:
+        start = time.perf_counter()
+        extensions = cythonize(
+            [os.path.join(PACKAGE, os.path.basename(source)) for source in sources],
+            quiet=True, language_level=3,
+            shared_utility_qualified_name=SHARED_MODULE if shared else None,
+        )
+        cython_time = time.perf_counter() - start
+
+        distribution = Distribution(dict(ext_modules=extensions))
+        command = distribution.get_command_obj('build_ext')
+        command.inplace = True
+        command.parallel = parallel
+        distribution.verbose = 0
+        start = time.perf_counter()
+        distribution.run_command('build_ext')
+        cc_time = time.perf_counter() - start
+    finally:
+        os.chdir(cwd)
+
+    sizes = {}
+    for so_file in glob.glob(os.path.join(pkg_dir, '*.so')) + glob.glob(os.path.join(pkg_dir, '*.pyd')):
+        sizes[os.path.basename(so_file).split('.')[0]] = os.path.getsize(so_file)
+    return cython_time, cc_time, sizes
+
+
+def format_size(size):
+    return f"{size / 1024:9.1f} KiB"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('-j', dest='parallel', type=int, default=None,
+                        help='number of parallel C compiler jobs (default: serial)')
+    parser.add_argument('sources', nargs='*',
+                        default=sorted(glob.glob(os.path.join(REPO_DIR, 'Demos', 'benchmarks', 'bm_*.py'))))
+    args = parser.parse_args()
+
+    results = {}
+    with tempfile.TemporaryDirectory(prefix='shared-utility-benchmark-') as temp_dir:
+        for shared in (False, True):
+            work_dir = os.path.join(temp_dir, 'shared' if shared else 'separate')
+            results[shared] = build(args.sources, work_dir, shared, args.parallel)
+
+    (cython_separate, cc_separate, sizes_separate) = results[False]
+    (cython_shared, cc_shared, sizes_shared) = results[True]
+    shared_module_size = sizes_shared.pop(SHARED_MODULE.rsplit('.', 1)[-1], 0)
+
+    print(f"{'module':30} {'separate':>13} {'shared':>13}")
+    for name in sorted(sizes_separate):
+        print(f"{name:30} {format_size(sizes_separate[name])} {format_size(sizes_shared.get(name, 0))}")
+    total_separate = sum(sizes_separate.values())
+    total_shared = sum(sizes_shared.values())
+    print(f"{'shared utility module':30} {'':>13} {format_size(shared_module_size)}")
+    print(f"{'total':30} {format_size(total_separate)} {format_size(total_shared + shared_module_size)}")
+    print(f"{'average per module':30} {format_size(total_separate / len(sizes_separate))} "
+          f"{format_size(total_shared / len(sizes_shared))}")
+    print()
+    print(f"{'Cython time':30} {cython_separate:11.2f} s {cython_shared:11.2f} s")
+    print(f"{'C compile time':30} {cc_separate:11.2f} s {cc_shared:11.2f} s")
+
+
+if __name__ == '__main__':
+    main()
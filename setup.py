@@ -435,7 +435,15 @@ packages = [
 ]
 
 
+def generate_lexicon_tables():
+    # Precompute the state tables of the scanner to avoid building its DFA at runtime.
+    from Cython.Compiler.Lexicon import write_lexicon_tables
+    source_root = os.path.abspath(os.path.dirname(__file__))
+    write_lexicon_tables(os.path.join(source_root, 'Cython', 'Compiler', 'LexiconTables.py'))
+
+
 def run_build():
+    generate_lexicon_tables()
     if compile_cython_itself and (is_cpython or cython_compile_more or cython_compile_minimal):
         compile_cython_modules(cython_profile, cython_coverage, cython_compile_minimal, cython_compile_more, cython_with_refnanny,
                                cython_limited_api)
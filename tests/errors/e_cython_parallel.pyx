@@ -174,6 +174,29 @@ def bar():
     with nogil, parallel.parallel(use_threads_if=python_var):
         pass
 
+def element_reductions(int[:] data, double[:] out, object[:] objects):
+    cdef int i, j
+
+    for i in prange(10, nogil=True, element_reduction='invalid'):
+        pass
+
+    for i in prange(10, nogil=True, element_reduction='tree'):
+        out[data[i]] /= 2
+
+    for i in prange(10, nogil=True, element_reduction='tree'):
+        out[data[i]] += 1
+        out[data[i]] *= 2
+
+    for i in prange(10, nogil=True, element_reduction='atomic'):
+        out[data[i]] += out[0]
+
+    for i in prange(10, element_reduction='tree'):
+        objects[i] += 1
+
+    for i in prange(10, nogil=True):
+        for j in prange(10, element_reduction='tree'):
+            out[j] += 1
+
 
 _ERRORS = u"""
 7:8: cython.parallel.parallel is not a module
@@ -213,6 +236,13 @@ _ERRORS = u"""
 162:57: Calling gil-requiring function not allowed without gil
 171:51: use_threads_if may not be a Python object as we don't have the GIL
 174:49: use_threads_if may not be a Python object as we don't have the GIL
+180:19: Invalid element_reduction argument to prange: invalid
+184:11: Invalid element reduction operator '/'
+188:11: Reduction operator '*' is inconsistent with previous reduction operator '+'
+191:24: Element reduction variable 'out' can only be used in in-place operators
+193:19: prange without releasing the GIL will only work well on freethreaded Python
+194:15: Element reductions need C integer or floating point items, not 'Python object'
+197:23: element_reduction is not supported in nested parallel sections
 
 # Unrelated warnings.
 26:4: 'cpdef_method' redeclared
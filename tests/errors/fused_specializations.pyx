@@ -0,0 +1,21 @@
+# mode: error
+
+cimport cython
+
+@cython.fused_specializations("double", "long")
+def unknown_signature(cython.floating x):
+    return x
+
+@cython.fused_specializations("float")
+cdef cython.floating pruned(cython.floating x):
+    return x
+
+def use_pruned():
+    return pruned[double](1.0)
+
+
+_ERRORS = """
+5:0: Unknown fused specialization 'long', expected one of: float, double
+14:17: Specialization was not selected by the fused_specializations directive
+14:11: Invalid use of fused types, type cannot be specialized
+"""
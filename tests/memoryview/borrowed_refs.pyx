@@ -1,6 +1,7 @@
 # mode: run
 # tag: memoryview, parallel
 
+cimport cython
 from cython.parallel import prange
 
 import gc
@@ -163,8 +164,6 @@ def use_borrowed_refs5(double[:] x, double[:] y):
 
     print("done")
 
-'''
-TODO - doesn't work currently
 def use_borrowed_refs_prange(double[:, :] x):
     """
     >>> use_borrowed_refs_prange(DoubleMockBuffer("x", range(300), (150,2)))
@@ -184,7 +183,44 @@ def use_borrowed_refs_prange(double[:, :] x):
     assert clear_count == 0, clear_count
 
     print("done")
-'''
+
+cdef double first(double[:] x) nogil noexcept:
+    return x[0]
+
+def use_borrowed_refs_return_call(double[:, :] x):
+    """
+    >>> use_borrowed_refs_return_call(DoubleMockBuffer("x", range(300), (150,2)))
+    acquired x
+    released x
+    2.0
+    """
+    cdef int incref_count = 0
+    cdef int clear_count = 0
+
+    # Only the argument of the call is sliced, not the returned value.
+    # Any reference counting would show up in the result.
+    return first(x[1, :]) + incref_count + clear_count
+
+@cython.borrowed_slices(True)
+def use_borrowed_refs_directive_attr(C c):
+    """
+    >>> c = C(DoubleMockBuffer(None, range(300), (150,2)))
+    >>> use_borrowed_refs_directive_attr(c)
+    done
+    """
+    cdef int incref_count = 0
+    cdef int clear_count = 0
+    cdef Py_ssize_t i
+
+    for i in prange(c.attr.shape[0], nogil=True):
+        empty(c.attr[i, :])
+    for i in range(c.attr.shape[0]):
+        empty(global_memview[i, :])
+
+    assert incref_count == 0, incref_count
+    assert clear_count == 0, clear_count
+
+    print("done")
 
 def use_borrowed_refs_generator(double[:, :] x):
     """
@@ -357,24 +393,20 @@ def dont_use_borrowed_refs_closure2(double[:,:] x):
     del inner
     gc.collect()
 
-def dont_use_borrowed_refs_prange(double[:, :] x):
+def dont_use_borrowed_refs_prange_global():
     """
-    >>> dont_use_borrowed_refs_prange(DoubleMockBuffer("x", range(300), (150,2)))
-    acquired x
+    >>> dont_use_borrowed_refs_prange_global()
     done
-    released x
     """
     cdef int incref_count = 0
     cdef int clear_count = 0
     cdef Py_ssize_t i
 
-    for i in prange(x.shape[0], nogil=True):
-        empty(x[i, :])
-
-    assert incref_count >= x.shape[0], incref_count
-    assert clear_count >= x.shape[0], clear_count
+    # Without the 'borrowed_slices' directive, globals may change while the slice is used.
+    for i in prange(global_memview.shape[0], nogil=True):
+        empty(global_memview[i, :])
 
-    # any assignment to x means that we don't trust borrowed refs in a prange
-    x = DoubleMockBuffer(None, range(4), (2, 2))
+    assert incref_count >= global_memview.shape[0], incref_count
+    assert clear_count >= global_memview.shape[0], clear_count
 
     print("done")
@@ -315,3 +315,69 @@ match arr:
 
     return isinstance(arr, Sequence)
 
+
+from libc.stdint cimport uintptr_t
+
+def test_aligned_array(shape, Py_ssize_t alignment, mode='c', padded=False, pooled=False):
+    """
+    >>> test_aligned_array((3, 5), 64)
+    ((40, 8), 64)
+    >>> test_aligned_array((3, 5), 64, padded=True)
+    ((64, 8), 64)
+    >>> test_aligned_array((3, 5), 32, mode='fortran', padded=True)
+    ((8, 32), 32)
+    >>> test_aligned_array((3, 4), 32, padded=True)  # rows are already aligned
+    ((32, 8), 32)
+    >>> test_aligned_array((3, 5), 128, padded=True, pooled=True)
+    ((128, 8), 128)
+    >>> test_aligned_array((3, 5), 0, pooled=True)
+    ((40, 8), 0)
+    >>> test_aligned_array((3, 5), 3)
+    Traceback (most recent call last):
+    ValueError: alignment must be a power of two for cython.array
+    >>> test_aligned_array((3, 5), 0, padded=True)
+    Traceback (most recent call last):
+    ValueError: padded cython.array requires an alignment
+    """
+    cdef array arr = array(shape, sizeof(double), 'd', mode=mode,
+                           alignment=alignment, padded=padded, pooled=pooled)
+    if alignment:
+        assert (<uintptr_t> arr.data) % alignment == 0, <uintptr_t> arr.data
+    cdef double[:, :] m = arr
+    cdef int i, j
+    for i in range(m.shape[0]):
+        for j in range(m.shape[1]):
+            m[i, j] = i * 10 + j
+    cdef double[:, ::1] c = m.copy()
+    for i in range(m.shape[0]):
+        for j in range(m.shape[1]):
+            assert c[i, j] == i * 10 + j, (i, j, c[i, j])
+    return (m.strides[0], m.strides[1]), arr.alignment
+
+
+def test_padded_array_not_contiguous():
+    """
+    >>> test_padded_array_not_contiguous()
+    Traceback (most recent call last):
+    ValueError: Can only create a strided buffer of a padded array.
+    """
+    arr = array((3, 5), sizeof(double), 'd', alignment=64, padded=True)
+    cdef double[:, ::1] m = arr
+
+
+def test_pooled_array_reuse():
+    """
+    >>> test_pooled_array_reuse()
+    (True, 'x', None)
+    """
+    cdef uintptr_t first, second
+    arr = array((4, 5), sizeof(double), 'd', pooled=True)
+    first = <uintptr_t> (<array> arr).data
+    del arr
+    arr = array((3, 6), sizeof(double), 'd', pooled=True)
+    second = <uintptr_t> (<array> arr).data
+
+    objs = array((3,), sizeof(void*), 'O', alignment=64, pooled=True)
+    cdef object[:] m = objs
+    m[0] = "x"
+    return first == second, m[0], m[1]
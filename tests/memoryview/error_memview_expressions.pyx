@@ -0,0 +1,24 @@
+# mode: error
+# tag: memoryview
+
+def unassigned(double[:] a, double[:, :] b):
+    x = a * 2
+    print(a + 1)
+    a[:] = a + b
+    b[:] = a * 2
+    cdef double[:] c = a + 1
+
+
+def integer_sum(int[:] a):
+    x = sum(a * 2)
+    y = sum(a / 2.0) + sum(a > 0) + max(a * 2)
+
+
+_ERRORS = u'''
+5:10: Memoryview expressions can only be assigned to memoryview slices like 'result[:] = ...' or reduced with sum(), min() or max()
+6:12: Memoryview expressions can only be assigned to memoryview slices like 'result[:] = ...' or reduced with sum(), min() or max()
+7:13: Invalid operand types for '+' (double[:]; double[:, :])
+8:13: Memoryview expressions can only be assigned to memoryview slices like 'result[:] = ...' or reduced with sum(), min() or max()
+9:25: Memoryview expressions can only be assigned to memoryview slices like 'result[:] = ...' or reduced with sum(), min() or max()
+13:11: sum() of integer memoryview expressions is not supported, because it could overflow unlike Python's sum()
+'''
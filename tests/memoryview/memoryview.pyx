@@ -1435,6 +1435,53 @@ def test_untyped_index(i):
     cdef int[:] mview_arr = arr
     return mview_arr[i]  # should generate a performance hint
 
+cdef double _sum_doubles(double[:] mv):
+    cdef double total = 0
+    for x in mv:
+        total += x
+    return total
+
+def test_repeated_format_checks():
+    """
+    The validated buffer formats are cached, which must not let other
+    formats or other dtypes for the same format pass.
+
+    >>> test_repeated_format_checks()
+    6.0
+    6.0
+    Buffer dtype mismatch, expected 'double' but got 'float'
+    Buffer dtype mismatch, expected 'double' but got 'long long'
+    Buffer dtype mismatch, expected 'float' but got 'double'
+    6.0
+    """
+    from array import array
+    doubles = array('d', [1, 2, 3])
+    print(_sum_doubles(doubles))
+    print(_sum_doubles(doubles))
+    for values in [array('f', [1, 2, 3]), array('q', [1, 2, 3])]:
+        try:
+            _sum_doubles(values)
+        except ValueError as e:
+            print(e)
+    cdef float[:] floats
+    try:
+        floats = doubles
+    except ValueError as e:
+        print(e)
+    # Replace the cached formats with others.
+    cdef signed char[:] b
+    cdef unsigned char[:] B
+    cdef short[:] h
+    cdef unsigned short[:] H
+    cdef int[:] i
+    cdef unsigned int[:] I
+    cdef long long[:] q
+    cdef unsigned long long[:] Q
+    b, B, h, H = array('b', [1]), array('B', [1]), array('h', [1]), array('H', [1])
+    i, I, q, Q = array('i', [1]), array('I', [1]), array('q', [1]), array('Q', [1])
+    floats = array('f', [1])
+    print(_sum_doubles(doubles))
+
 _PERFORMANCE_HINTS = """
 243:9: Use boundscheck(False) for faster access
 1436:21: Index should be typed for more efficient access
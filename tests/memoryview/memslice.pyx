@@ -2178,6 +2178,52 @@ cdef _test_slice_assignment_broadcast_strides(slice_1d src, slice_2d dst, slice_
         for j in range(1, 3):
             assert dst[i, j] == dst_f[i, j] == j - 1, (dst[i, j], dst_f[i, j], j - 1)
 
+@testcase
+def test_slice_assignment_layouts():
+    """
+    >>> test_slice_assignment_layouts()
+    """
+    cdef int[:, :] src = array((70, 45), sizeof(int), 'i')
+    cdef int[:, :] dst_c = array((70, 45), sizeof(int), 'i')
+    cdef int[:, :] dst_f = array((70, 45), sizeof(int), 'i', mode='fortran')
+    cdef int[:, :] dst_t = array((45, 70), sizeof(int), 'i')
+    cdef int[:, :, :] src_3d = array((6, 7, 8), sizeof(int), 'i')
+    cdef int[:, :, :] dst_3d = array((3, 7, 8), sizeof(int), 'i', mode='fortran')
+    cdef int i, j, k
+
+    for i in range(70):
+        for j in range(45):
+            src[i, j] = i * 45 + j
+
+    # Different memory layouts are copied in tiles
+    dst_f[:, :] = src
+    dst_t[:, :] = src.T
+    dst_c[:, :] = dst_f[::-1, ::-1]
+    for i in range(70):
+        for j in range(45):
+            assert dst_f[i, j] == dst_t[j, i] == src[i, j], (i, j, dst_f[i, j], dst_t[j, i])
+            assert dst_c[i, j] == src[69 - i, 44 - j], (i, j, dst_c[i, j])
+
+    # ... also when broadcasting
+    dst_f[:, :] = src[3, :]
+    dst_t[:, :] = dst_c[:, 0]
+    for i in range(70):
+        for j in range(45):
+            assert dst_f[i, j] == src[3, j], (i, j, dst_f[i, j])
+            assert dst_t[j, i] == dst_c[i, 0], (i, j, dst_t[j, i])
+
+    # Dimensions that are contiguous in both slices are copied as one run
+    for i in range(6):
+        for j in range(7):
+            for k in range(8):
+                src_3d[i, j, k] = (i * 7 + j) * 8 + k
+    dst_3d[:, :, :] = src_3d[::2]
+    assert dst_3d.copy()[2, 6, 7] == src_3d[4, 6, 7]
+    dst_f = dst_3d[1].copy_fortran()
+    for j in range(7):
+        for k in range(8):
+            assert dst_f[j, k] == dst_3d[1, j, k] == src_3d[2, j, k], (j, k, dst_f[j, k])
+
 @testcase
 def test_borrowed_slice():
     """
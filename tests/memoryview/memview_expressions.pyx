@@ -0,0 +1,291 @@
+# cython: language_level=3
+# mode: run
+# tag: memoryview, optimisation
+
+cimport cython
+
+from array import array
+
+
+def make_2d(rows, columns, typecode='d'):
+    return memoryview(array(typecode, range(rows * columns))).cast('B').cast(typecode, [rows, columns])
+
+
+@cython.test_assert_path_exists("//MemoryCopyExpression", "//ElementwiseMemoryViewNode")
+@cython.test_fail_if_path_exists("//CoerceToPyTypeNode")
+def axpy(double[:] out, double a, double[:] x, double[:] y):
+    """
+    >>> out = array('d', [0] * 3)
+    >>> axpy(out, 2, array('d', [1, 2, 3]), array('d', [10, 20, 30]))
+    >>> out.tolist()
+    [12.0, 24.0, 36.0]
+    >>> axpy(out, 2, array('d', [1, 2, 3]), array('d', [10, 20]))
+    Traceback (most recent call last):
+    ValueError: got differing extents in dimension 0 (got 3 and 2)
+    """
+    out[:] = a * x + y
+
+
+def scale_2d(double[:, :] out, double[:, ::1] a, int factor):
+    """
+    >>> out = make_2d(2, 3)
+    >>> scale_2d(out, make_2d(2, 3), 3)
+    >>> out.tolist()
+    [[1.0, -2.0, -5.0], [-8.0, -11.0, -14.0]]
+    """
+    out[...] = -a * factor + 1
+
+
+def divide_ints(double[:] out, int[:] a, int[:] b):
+    """
+    >>> out = array('d', [0] * 3)
+    >>> divide_ints(out, array('i', [1, 3, -7]), array('i', [2, 2, 2]))
+    >>> out.tolist()
+    [0.5, 1.5, -3.5]
+    """
+    out[:] = a / b
+
+
+def divide_by_zero(double[:] out, int[:] a, int[:] b):
+    """
+    >>> out = array('d', [0] * 3)
+    >>> divide_by_zero(out, array('i', [1, 2, 3]), array('i', [2, 0, 1]))
+    Traceback (most recent call last):
+    ZeroDivisionError: float division
+    >>> divide_by_zero(out, array('i', [1, 2, 3]), array('i', [2, 4, 1]))
+    Traceback (most recent call last):
+    ZeroDivisionError: float division
+    >>> out.tolist()
+    [-0.5, 0.5, 3.0]
+    """
+    out[:] = a / b
+    out[:] = out / (a - 2)
+
+
+def divide_by_zero_nogil(double[:] a, double x):
+    """
+    >>> divide_by_zero_nogil(array('d', [1, 2]), 2)
+    (1.5, 1.0)
+    >>> divide_by_zero_nogil(array('d', [1, 2]), 0)
+    Traceback (most recent call last):
+    ZeroDivisionError: float division
+    """
+    cdef double s, m
+    with nogil:
+        s = sum(a / x)
+        m = max(a / x)
+    return s, m
+
+
+@cython.cdivision(True)
+def cdivision_by_zero(double[:] out, double[:] a, double[:] b):
+    """
+    >>> out = array('d', [0] * 2)
+    >>> cdivision_by_zero(out, array('d', [1, -1]), array('d', [0, 0]))
+    >>> out.tolist()
+    [inf, -inf]
+    """
+    out[:] = a / b
+
+
+def convert_to_int(int[:] out, double[:] a):
+    """
+    >>> out = array('i', [0] * 3)
+    >>> convert_to_int(out, array('d', [1.5, 2.25, -3.75]))
+    >>> out.tolist()
+    [3, 4, -7]
+    """
+    out[:] = a * 2
+
+
+def compare(int[:] out, double[:] a, double limit):
+    """
+    >>> out = array('i', [0] * 4)
+    >>> compare(out, array('d', [1, 5, 2, 7]), 3)
+    >>> out.tolist()
+    [0, 1, 0, 1]
+    """
+    out[:] = a > limit
+
+
+def compare_expressions(int[:] out, int[:] a, int[:] b):
+    """
+    >>> out = array('i', [0] * 3)
+    >>> compare_expressions(out, array('i', [1, 2, 3]), array('i', [3, 2, 1]))
+    >>> out.tolist()
+    [0, 1, 0]
+    """
+    out[:] = (a - b) == 0
+
+
+def in_place(double[:] a, double[:] b):
+    """
+    >>> a = array('d', [1, 2, 3])
+    >>> in_place(a, array('d', [1, 1, 1]))
+    >>> a.tolist()
+    [3.0, 5.0, 7.0]
+    """
+    a[:] = a * 2 + b
+
+
+def shifted(double[:] a):
+    """
+    >>> a = array('d', [1, 2, 3, 4])
+    >>> shifted(a)
+    >>> a.tolist()
+    [1.0, 3.0, 5.0, 7.0]
+    >>> a = array('d', [1, 2, 3, 4])
+    >>> shifted_back(a)
+    >>> a.tolist()
+    [3.0, 5.0, 7.0, 4.0]
+    """
+    a[1:] = a[1:] + a[:-1]
+
+
+def shifted_back(double[:] a):
+    a[:-1] = a[1:] + a[:-1]
+
+
+def fortran_order(double[::1, :] out, double[::1, :] a):
+    """
+    >>> fortran_order_transposed(make_2d(3, 2))
+    [[0.0, 4.0, 8.0], [2.0, 6.0, 10.0]]
+    """
+    out[:, :] = a + a
+
+
+def fortran_order_transposed(m):
+    cdef double[:, ::1] mv = m
+    cdef double[::1, :] out = mv.copy().T
+    fortran_order(out, mv.T)
+    return [[out[i, j] for j in range(out.shape[1])] for i in range(out.shape[0])]
+
+
+@cython.test_assert_path_exists("//MemoryViewReductionNode")
+def dot(double[:] a, double[:] b):
+    """
+    >>> dot(array('d', [1, 2, 3]), array('d', [4, 5, 6]))
+    32.0
+    >>> dot(array('d'), array('d'))
+    0.0
+    """
+    return sum(a * b)
+
+
+@cython.test_assert_path_exists("//MemoryViewReductionNode")
+def sum_floats(float[:] a):
+    """
+    >>> sum_floats(array('f', [0.5, 1.5, 2.0]))
+    4.0
+    """
+    cdef double s = sum(a)
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewReductionNode")
+def sum_doubles(double[:] a):
+    """
+    The result is the same as that of Python's sum(), which compensates
+    rounding errors in Py3.12+.
+
+    >>> values = array('d', [1e16, 1.0, -1e16])
+    >>> sum_doubles(values) == sum(values)
+    True
+    >>> sum_doubles(array('d', [1e16, 1.0, 1.0, -1e16])) == sum([1e16, 1.0, 1.0, -1e16])
+    True
+    >>> sum_doubles(array('d', [-0.0, -0.0]))
+    0.0
+    >>> sum_doubles(array('d', [1e308, 1e308, -1e308]))
+    inf
+    """
+    return sum(a)
+
+
+@cython.test_assert_path_exists("//MemoryViewReductionNode")
+def sum_products(double[:] a, double[:] b):
+    """
+    >>> sum_products(array('d', [1e16, 1.0, -1e16]), array('d', [1, 1, 1])) == sum([1e16, 1.0, -1e16])
+    True
+    """
+    return sum(a * b)
+
+
+@cython.test_fail_if_path_exists("//MemoryViewReductionNode")
+def sum_ints(long long[:] a):
+    """
+    >>> sum_ints(array('q', [2**62, 2**62, 2**62]))
+    13835058055282163712
+    """
+    return sum(a)
+
+
+def sum_2d(int[:, :] a):
+    """
+    >>> sum_2d(make_2d(3, 4, 'i'))
+    198.0
+    """
+    return sum(a * 3.0)
+
+
+@cython.test_assert_path_exists("//MemoryViewReductionNode")
+def count_positive(int[:, :] a):
+    """
+    >>> count_positive(make_2d(3, 4, 'i'))
+    11
+    """
+    return sum(a > 0)
+
+
+@cython.test_assert_path_exists("//MemoryViewReductionNode")
+def min_max(int[:] a):
+    """
+    >>> min_max(array('i', [3, -1, 4, 1, -5, 9]))
+    (-5, 9)
+    >>> min_max(array('i', [7]))
+    (7, 7)
+    >>> min_max(array('i'))
+    Traceback (most recent call last):
+    ValueError: min() arg is an empty sequence
+    """
+    return min(a), max(a)
+
+
+def max_difference(double[:] a, double[:] b):
+    """
+    >>> max_difference(array('d', [1, 5, 3]), array('d', [2, 1, 3]))
+    4.0
+    """
+    return max(a - b)
+
+
+def nogil_expressions(double[:] out, double[:] a, double[:] b):
+    """
+    >>> out = array('d', [0] * 3)
+    >>> nogil_expressions(out, array('d', [1, 2, 3]), array('d', [3, 2, 1]))
+    (4.0, 3.0)
+    >>> out.tolist()
+    [4.0, 4.0, 4.0]
+    >>> nogil_expressions(out, array('d', [1, 2, 3]), array('d', [3, 2]))
+    Traceback (most recent call last):
+    ValueError: got differing extents in dimension 0 (got 3 and 2)
+    >>> nogil_expressions(array('d'), array('d'), array('d'))
+    Traceback (most recent call last):
+    ValueError: max() arg is an empty sequence
+    """
+    cdef double s, m
+    with nogil:
+        out[:] = a + b
+        s = sum(out) / 3
+        m = max(a + b - 1)
+    return s, m
+
+
+def python_semantics(double[:] a, b):
+    """
+    >>> python_semantics(array('d', [1, 2]), array('d', [1, 2]))
+    True
+    >>> python_semantics(array('d', [1, 2]), array('d', [1, 3]))
+    False
+    """
+    # memoryview slices still compare as Python objects
+    return a == memoryview(b)
@@ -0,0 +1,183 @@
+# mode: run
+# tag: memoryview, optimisation
+
+# cython: test_fail_if_c_code_has = /__pyx_pf_\w+\dsum_2d\([^;]*{/:/\n}/ __Pyx_RaiseBufferIndexError
+# cython: test_fail_if_c_code_has = /__pyx_pf_\w+\dsum_reversed\([^;]*{/:/\n}/ __Pyx_RaiseBufferIndexError
+# cython: test_assert_c_code_has = /__pyx_pf_\w+\dsum_range\([^;]*{/:/\n}/ __Pyx_RaiseBufferIndexError
+# cython: test_assert_c_code_has = /__pyx_pf_\w+\dsum_range_narrow\([^;]*{/:/\n}/ \(int\)__pyx_v_start
+# cython: test_assert_c_code_has = /__pyx_pf_\w+\dsum_shape_narrow\([^;]*{/:/\n}/ __Pyx_RaiseBufferIndexError
+
+cimport cython
+
+from array import array
+
+
+def make_2d(rows, columns):
+    return memoryview(array('d', range(rows * columns))).cast('B').cast('d', [rows, columns])
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def sum_2d(double[:, :] mv):
+    """
+    >>> sum_2d(make_2d(3, 4))
+    66.0
+    >>> sum_2d(make_2d(1, 1))
+    0.0
+    """
+    cdef Py_ssize_t i, j
+    cdef double s = 0
+    for i in range(len(mv)):
+        for j in range(mv.shape[1]):
+            s += mv[i, j]
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def sum_reversed(double[:] mv):
+    """
+    >>> sum_reversed(array('d', [1, 2, 3]))
+    [3.0, 2.0, 1.0]
+    """
+    cdef Py_ssize_t i
+    result = []
+    for i in reversed(range(mv.shape[0])):
+        result.append(mv[i])
+    return result
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def sum_range(double[:] mv, Py_ssize_t start, Py_ssize_t stop):
+    """
+    >>> sum_range(array('d', [1, 2, 4, 8]), 1, 3)
+    6.0
+    >>> sum_range(array('d', [1, 2, 4, 8]), 0, 4)
+    15.0
+    >>> sum_range(array('d', [1, 2, 4, 8]), -2, 1)
+    13.0
+    >>> sum_range(array('d', [1, 2, 4, 8]), 2, 5)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    >>> sum_range(array('d', [1, 2, 4, 8]), -5, 0)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef Py_ssize_t i
+    cdef double s = 0
+    for i in range(start, stop):
+        s += mv[i]
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def sum_range_narrow(double[:] mv, Py_ssize_t start, Py_ssize_t stop):
+    """
+    >>> sum_range_narrow(array('d', [1, 2, 4, 8]), 1, 3)
+    6.0
+    >>> sum_range_narrow(array('d', [1, 2, 4, 8]), 2**32 - 1, 2)  # starts at -1
+    11.0
+    >>> sum_range_narrow(array('d', [1, 2, 4, 8]), 2**32 + 2, 5)  # starts at 2
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef int i
+    cdef double s = 0
+    for i in range(start, stop):
+        s += mv[i]
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def sum_shape_narrow(double[:] mv):
+    """
+    >>> sum_shape_narrow(array('d', [1, 2, 4]))
+    7.0
+    """
+    cdef signed char i
+    cdef double s = 0
+    for i in range(mv.shape[0]):
+        s += mv[i]
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def sum_rows_backwards(double[:, :] mv, Py_ssize_t last_row, size_t columns):
+    """
+    >>> sum_rows_backwards(make_2d(3, 4), 2, 4)
+    66.0
+    >>> sum_rows_backwards(make_2d(3, 4), 1, 2)
+    10.0
+    >>> sum_rows_backwards(make_2d(3, 4), 3, 4)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    >>> sum_rows_backwards(make_2d(3, 4), 2, 5)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 1)
+    """
+    cdef Py_ssize_t i
+    cdef size_t j
+    cdef double s = 0
+    for i in range(last_row, -1, -1):
+        for j in range(columns):
+            s += mv[i, j]
+    return s
+
+
+@cython.test_fail_if_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def modified_loop_variable(double[:] mv):
+    """
+    >>> modified_loop_variable(array('d', [1, 2, 3]))
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef Py_ssize_t i
+    cdef double s = 0
+    for i in range(mv.shape[0]):
+        i += 1
+        s += mv[i]
+    return s
+
+
+@cython.test_fail_if_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def modified_loop_variable_pointer(double[:] mv):
+    """
+    >>> modified_loop_variable_pointer(array('d', [1, 2, 3]))
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef Py_ssize_t i
+    cdef Py_ssize_t *p = &i
+    cdef double s = 0
+    for i in range(mv.shape[0]):
+        p[0] += 1
+        s += mv[i]
+    return s
+
+
+@cython.test_fail_if_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def modified_memoryview(double[:] mv):
+    """
+    >>> modified_memoryview(array('d', [1, 2, 3]))
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef Py_ssize_t i
+    cdef double s = 0
+    for i in range(mv.shape[0]):
+        s += mv[i]
+        mv = mv[1:]
+    return s
+
+
+@cython.boundscheck(False)
+@cython.wraparound(False)
+@cython.test_fail_if_path_exists("//MemoryViewIndexNode[@index_bounds]")
+def unchecked(double[:] mv):
+    """
+    >>> unchecked(array('d', [1, 2, 3]))
+    6.0
+    """
+    cdef Py_ssize_t i
+    cdef double s = 0
+    for i in range(mv.shape[0]):
+        s += mv[i]
+    return s
@@ -0,0 +1,246 @@
+# mode: run
+# tag: memoryview, optimisation
+
+# cython: test_assert_c_code_has = /__pyx_pf_\w+\dsum_rows_narrow\([^;]*{/:/\n}/ \(__pyx_v_i < 0 \?
+# cython: test_assert_c_code_has = /__pyx_pf_\w+\dsum_all_narrow\([^;]*{/:/\n}/ \(__pyx_v_i < 0 \?
+
+cimport cython
+
+from array import array
+
+
+def make_2d(rows, columns, typecode='d'):
+    return memoryview(array(typecode, range(rows * columns))).cast('B').cast(typecode, [rows, columns])
+
+
+def make_fortran_2d(rows, columns):
+    cdef double[:, ::1] mv = make_2d(columns, rows)
+    return mv.T
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def scale_rows(double[:, :] out, double[:, :] a, double[:] b):
+    """
+    >>> out = make_2d(2, 3)
+    >>> scale_rows(out, make_2d(2, 3), array('d', [1, 2, 3]))
+    >>> out.tolist()
+    [[0.0, 2.0, 6.0], [3.0, 8.0, 15.0]]
+    """
+    cdef Py_ssize_t i, j
+    for i in range(out.shape[0]):
+        for j in range(out.shape[1]):
+            out[i, j] = a[i, j] * b[j]
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def scale_contiguous_rows(double[:, ::1] out, double[:, ::1] a, double[::1] b):
+    """
+    >>> out = make_2d(2, 3)
+    >>> scale_contiguous_rows(out, make_2d(2, 3), array('d', [1, 2, 3]))
+    >>> out.tolist()
+    [[0.0, 2.0, 6.0], [3.0, 8.0, 15.0]]
+    """
+    cdef Py_ssize_t i, j
+    for i in range(out.shape[0]):
+        for j in range(out.shape[1]):
+            out[i, j] = a[i, j] * b[j]
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def sum_columns(double[::1, :] mv):
+    """
+    >>> sum_columns(make_fortran_2d(4, 3))
+    [6.0, 22.0, 38.0]
+    """
+    cdef Py_ssize_t i, j
+    result = []
+    for j in range(mv.shape[1]):
+        s = 0.0
+        for i in range(mv.shape[0]):
+            s += mv[i, j]
+        result.append(s)
+    return result
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def sum_row(double[:, :] mv, Py_ssize_t row, Py_ssize_t columns):
+    """
+    >>> sum_row(make_2d(3, 4), 1, 4)
+    22.0
+    >>> sum_row(make_2d(3, 4), -1, 4)
+    38.0
+    >>> sum_row(make_2d(3, 4), 1, 0)
+    0.0
+    >>> sum_row(make_2d(3, 4), 3, 0)
+    0.0
+    >>> sum_row(make_2d(3, 4), 3, 4)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    >>> sum_row(make_2d(3, 4), -4, 4)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    >>> sum_row(make_2d(3, 4), 0, 5)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 1)
+    """
+    cdef Py_ssize_t j
+    cdef double s = 0
+    for j in range(columns):
+        s += mv[row, j]
+    return s
+
+
+@cython.wraparound(False)
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def sum_row_no_wraparound(int[:, :] mv, int row):
+    """
+    >>> sum_row_no_wraparound(make_2d(3, 4, 'i'), 2)
+    38
+    >>> sum_row_no_wraparound(make_2d(3, 4, 'i'), -1)
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef int j, s = 0
+    for j in range(mv.shape[1]):
+        s += mv[row, j]
+    return s
+
+
+@cython.boundscheck(False)
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def sum_row_no_boundscheck(double[:, :] mv, Py_ssize_t row):
+    """
+    >>> sum_row_no_boundscheck(make_2d(3, 4), 1)
+    22.0
+    >>> sum_row_no_boundscheck(make_2d(3, 4), -1)
+    38.0
+    """
+    cdef Py_ssize_t j
+    cdef double s = 0
+    for j in range(mv.shape[1]):
+        s += mv[row, j]
+    return s
+
+
+@cython.test_assert_path_exists(
+    "//MemoryViewIndexNode[@hoisted_access]",
+    "//MemoryViewIndexNode[@index_bounds]")
+def sum_all(double[:, :] mv):
+    """
+    >>> sum_all(make_2d(3, 4))
+    66.0
+    """
+    cdef Py_ssize_t i, j
+    cdef double s = 0
+    for i in range(len(mv)):
+        for j in range(mv.shape[1]):
+            s += mv[i, j]
+    return s
+
+
+@cython.test_assert_path_exists(
+    "//MemoryViewIndexNode[@hoisted_access]",
+    "//MemoryViewIndexNode[@index_bounds]")
+def sum_rows_narrow(double[:, :] mv, Py_ssize_t start, Py_ssize_t stop):
+    """
+    >>> sum_rows_narrow(make_2d(3, 4), 1, 3)
+    60.0
+    >>> sum_rows_narrow(make_2d(3, 4), 2**32 - 1, 1)  # starts at -1
+    44.0
+    >>> sum_rows_narrow(make_2d(3, 4), 2**32 + 2, 4)  # starts at 2
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef int i
+    cdef Py_ssize_t j
+    cdef double s = 0
+    for i in range(start, stop):
+        for j in range(mv.shape[1]):
+            s += mv[i, j]
+    return s
+
+
+@cython.test_assert_path_exists(
+    "//MemoryViewIndexNode[@hoisted_access]",
+    "//MemoryViewIndexNode[@index_bounds]")
+def sum_all_narrow(double[:, :] mv):
+    """
+    >>> sum_all_narrow(make_2d(3, 4))
+    66.0
+    """
+    cdef signed char i
+    cdef Py_ssize_t j
+    cdef double s = 0
+    for i in range(len(mv)):
+        for j in range(mv.shape[1]):
+            s += mv[i, j]
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def sum_second_row(double[:, :] mv):
+    """
+    >>> sum_second_row(make_2d(3, 4))
+    22.0
+    >>> sum_second_row(make_2d(1, 4))
+    Traceback (most recent call last):
+    IndexError: Out of bounds on buffer access (axis 0)
+    """
+    cdef Py_ssize_t j
+    cdef double s = 0
+    for j in range(mv.shape[1]):
+        s += mv[1, j]
+    return s
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def first_column(double[:, :] mv):
+    """
+    >>> first_column(make_2d(3, 4))
+    [0.0, 4.0, 8.0]
+    """
+    cdef Py_ssize_t i
+    return [mv[i, 0] for i in range(mv.shape[0])]
+
+
+@cython.test_assert_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def modified_row(double[:, :] mv):
+    """
+    >>> modified_row(make_2d(3, 2))
+    [0.0, 3.0, 4.0]
+    """
+    cdef Py_ssize_t i = 0, j
+    result = []
+    for j in range(mv.shape[0]):
+        result.append(mv[i, j % 2])
+        i += 1
+        i %= mv.shape[0]
+    return result
+
+
+@cython.test_fail_if_path_exists("//MemoryViewIndexNode[@hoisted_access]")
+def assigned_memoryview(double[:, :] mv):
+    """
+    >>> assigned_memoryview(make_2d(3, 2))
+    [0.0, 3.0, 4.0]
+    """
+    cdef Py_ssize_t j
+    result = []
+    for j in range(3):
+        result.append(mv[0, j % 2])
+        mv = mv[1:]
+    return result
+
+
+def row_pointer(double[:, :] mv):
+    """
+    >>> row_pointer(make_2d(2, 2))
+    [0.0, 3.0]
+    """
+    cdef Py_ssize_t i = 0, j
+    cdef Py_ssize_t *p = &i
+    result = []
+    for j in range(2):
+        result.append(mv[i, j])
+        p[0] += 1
+    return result
@@ -0,0 +1,140 @@
+# mode: run
+# tag: getattr, methodcall
+# cython: optimize.cache_attribute_lookups=True
+
+cimport cython
+
+
+def get_x(obj):
+    """
+    >>> class Plain:
+    ...     x = 'class'
+    >>> p = Plain()
+    >>> get_x(p)
+    'class'
+    >>> p.x = 'instance'
+    >>> get_x(p)
+    'instance'
+    >>> del p.x
+    >>> get_x(p)
+    'class'
+    >>> Plain.x = 'modified'
+    >>> get_x(p)
+    'modified'
+    >>> del Plain.x
+    >>> get_x(p)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    AttributeError: ...x...
+
+    >>> class Slotted:
+    ...     __slots__ = ('x',)
+    >>> s = Slotted()
+    >>> get_x(s)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    AttributeError: ...x...
+    >>> s.x = 1
+    >>> get_x(s)
+    1
+
+    >>> class WithProperty:
+    ...     @property
+    ...     def x(self):
+    ...         return 'property'
+    >>> w = WithProperty()
+    >>> w.__dict__['x'] = 'shadowed'
+    >>> get_x(w)
+    'property'
+
+    >>> class WithGetattr:
+    ...     def __getattr__(self, name):
+    ...         return 'getattr ' + name
+    >>> get_x(WithGetattr())
+    'getattr x'
+
+    >>> get_x(Ext())
+    'ext'
+    >>> get_x(ExtSub())
+    'sub'
+    """
+    return obj.x
+
+
+def get_x_repeated(objects):
+    """
+    >>> class A:
+    ...     x = 'A'
+    >>> class B:
+    ...     __slots__ = ('x',)
+    ...     def __init__(self): self.x = 'B'
+    >>> get_x_repeated([A(), B(), Ext(), A(), 1])  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    AttributeError: ...x...
+    >>> get_x_repeated([A(), B(), Ext(), A(), B()])
+    ['A', 'B', 'ext', 'A', 'B']
+    """
+    return [obj.x for obj in objects]
+
+
+def call_method(obj, arg):
+    """
+    >>> class Plain:
+    ...     def method(self, arg):
+    ...         return ('method', arg)
+    >>> p = Plain()
+    >>> call_method(p, 1)
+    ('method', 1)
+    >>> p.method = lambda arg: ('instance', arg)
+    >>> call_method(p, 2)
+    ('instance', 2)
+    >>> del p.method
+    >>> call_method(p, 3)
+    ('method', 3)
+    >>> Plain.method = lambda self, arg: ('replaced', arg)
+    >>> call_method(p, 4)
+    ('replaced', 4)
+    >>> Plain.method = staticmethod(lambda arg: ('static', arg))
+    >>> call_method(p, 5)
+    ('static', 5)
+    >>> call_method(Ext(), 6)
+    ('ext', 6)
+    >>> call_method([], 7)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    AttributeError: ...method...
+    """
+    return obj.method(arg)
+
+
+def call_append(obj, arg):
+    """
+    >>> l = []
+    >>> call_append(l, 1)
+    >>> call_append(l, 2)
+    >>> l
+    [1, 2]
+    """
+    obj.append(arg)
+
+
+def call_method_kwargs(obj, arg):
+    """
+    >>> call_method_kwargs(Ext(), 1)
+    ('ext', 1)
+    """
+    return obj.method(arg=arg)
+
+
+cdef class Ext:
+    @property
+    def x(self):
+        return 'ext'
+
+    def method(self, arg):
+        return ('ext', arg)
+
+
+cdef class ExtSub(Ext):
+    cdef dict __dict__
+
+    @property
+    def x(self):
+        return 'sub'
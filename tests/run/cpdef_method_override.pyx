@@ -137,3 +137,60 @@ class DynamicOverride(BaseType):
     def meth2(self):
         del self.meth
         print("meth2")
+
+
+class PySlotsNonOverride(BaseType):
+    """
+    >>> obj = PySlotsNonOverride()
+    >>> obj.callmeth()
+    BaseType.meth
+    >>> obj.callmeth()
+    BaseType.meth
+    >>> PySlotsNonOverride.meth = lambda self: print("patched")
+    >>> obj.callmeth()
+    patched
+    >>> del PySlotsNonOverride.meth
+    >>> obj.callmeth()
+    BaseType.meth
+    """
+    __slots__ = []
+
+
+class PySlotsNonOverrideSub(PySlotsNonOverride):
+    """
+    >>> obj = PySlotsNonOverrideSub()
+    >>> obj.callmeth()
+    BaseType.meth
+    >>> obj.callmeth()
+    BaseType.meth
+
+    Changes in base classes must also be picked up.
+
+    >>> PySlotsNonOverride.meth = lambda self: print("patched base")
+    >>> obj.callmeth()
+    patched base
+    >>> del PySlotsNonOverride.meth
+    >>> obj.callmeth()
+    BaseType.meth
+    """
+    __slots__ = []
+
+
+def call_alternating(n):
+    """
+    >>> call_alternating(2)
+    BaseType.meth
+    BaseType.meth
+    PySlotsClass.meth
+    BaseType.meth
+    BaseType.meth
+    BaseType.meth
+    BaseType.meth
+    PySlotsClass.meth
+    BaseType.meth
+    BaseType.meth
+    """
+    objects = [BaseType(), PySlotsNonOverride(), PySlotsClass(), PySlotsNonOverrideSub(), NonOverride()]
+    for _ in range(n):
+        for obj in objects:
+            obj.callmeth()
@@ -523,3 +523,136 @@ def test_signature(cython.floating arg1, cython.floating arg2):
     >>> list(parameters.keys())
     ['arg1', 'arg2']
     """
+
+
+def dispatch_cached(cython.integral a, cython.floating b):
+    return f"{cython.typeof(a)} {cython.typeof(b)}"
+
+def test_dispatch_cache():
+    """
+    >>> test_dispatch_cache()
+    long double
+    long double
+    long double
+    long double
+    """
+    # Repeated calls with the same argument types use the dispatch cache,
+    # calls with different types and keyword arguments must not get a wrong match.
+    print(dispatch_cached(1, 2.0))
+    print(dispatch_cached(1, 2.0))
+    print(dispatch_cached(1, b=2.0))
+    print(dispatch_cached(True, 2.0))
+
+def test_dispatch_cache_many_types():
+    """
+    >>> test_dispatch_cache_many_types()
+    """
+    # More combinations of types than the cache can hold, including subtypes.
+    class MyInt(int):
+        pass
+    class MyFloat(float):
+        pass
+    ints = [1, True, MyInt(2)]
+    floats = [1.5, MyFloat(2.5)]
+    for _ in range(20):
+        for a in ints:
+            for b in floats:
+                assert fused_in_class_method_dispatch(a, b) == (int, float), (a, b)
+
+def fused_in_class_method_dispatch(cython.integral a, cython.floating b):
+    return type(a).__mro__[-2], type(b).__mro__[-2]
+
+cdef class DispatchCacheMethods:
+    def meth(self, cython.floating x):
+        return cython.typeof(x)
+
+def test_dispatch_cache_methods():
+    """
+    >>> test_dispatch_cache_methods()
+    ['double', 'double', 'double']
+    """
+    objs = [DispatchCacheMethods() for _ in range(3)]
+    return [obj.meth(1.0) for obj in objs]
+
+def dispatch_cached_buffer(cython.floating[:] values):
+    return cython.typeof(values)
+
+def test_dispatch_cache_buffer():
+    """
+    >>> test_dispatch_cache_buffer()
+    double[:]
+    float[:]
+    double[:]
+    float[:]
+    No matching signature found
+    No matching signature found
+    """
+    from array import array
+    for _ in range(2):
+        print(dispatch_cached_buffer(array('d', [1.0])))
+        print(dispatch_cached_buffer(array('f', [1.0])))
+    for _ in range(2):
+        try:
+            dispatch_cached_buffer(array('i', [1]))
+        except TypeError as exc:
+            print(exc)
+
+ctypedef long long_alias
+
+ctypedef fused long_or_alias:
+    long
+    long_alias
+    double
+
+def merged_typedef(long_or_alias x):
+    return cython.typeof(x)
+
+def test_merged_typedef_specializations():
+    """
+    >>> test_merged_typedef_specializations()
+    ['double', 'long', 'long_alias']
+    True
+    long
+    long
+    double
+    """
+    print(sorted(merged_typedef.__signatures__))
+    print(merged_typedef['long_alias'] is merged_typedef['long'])
+    print(merged_typedef(1))
+    print(merged_typedef['long_alias'](1))
+    print(merged_typedef(1.0))
+
+@cython.fused_specializations("long|double", "int | float")
+def selected_specializations(cython.integral x, cython.floating y):
+    return cython.typeof(x), cython.typeof(y)
+
+@cython.fused_specializations("double")
+def selected_buffer_specialization(cython.floating[:] values):
+    return cython.typeof(values)
+
+def test_selected_specializations():
+    """
+    >>> test_selected_specializations()
+    ['int|float', 'long|double']
+    ('long', 'double')
+    ('int', 'float')
+    'long|float'
+    ['double']
+    double[:]
+    No matching signature found
+    """
+    print(sorted(selected_specializations.__signatures__))
+    print(selected_specializations(1, 2.0))
+    print(selected_specializations['int|float'](1, 2.0))
+    try:
+        selected_specializations['long|float']
+    except KeyError as exc:
+        print(repr(exc.args[0]))
+
+    from array import array
+    print(sorted(selected_buffer_specialization.__signatures__))
+    print(selected_buffer_specialization(array('d', [1.0])))
+    try:
+        selected_buffer_specialization(array('f', [1.0]))
+    except TypeError as exc:
+        print(exc)
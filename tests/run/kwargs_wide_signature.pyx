@@ -0,0 +1,61 @@
+# mode: run
+# tag: kwargs
+
+# Functions with many keyword arguments look up their names in a hash table.
+
+def wide(a=0, b=0, c=0, d=0, e=0, f=0, g=0, h=0,
+         alpha=0, beta=0, gamma=0, delta=0, epsilon=0, zeta=0, eta=0, theta=0):
+    """
+    >>> wide(theta=1, a=2)
+    (2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1)
+    >>> wide(1, 2, h=3, eta=4)
+    (1, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4, 0)
+    >>> wide(**{''.join(['ze', 'ta']): 5, ''.join(['b']): 6})
+    (0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0)
+
+    >>> wide(thetaa=1)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    TypeError: ...unexpected keyword argument 'thetaa'...
+    >>> wide(**{''.join(['the', 'tb']): 1})  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    TypeError: ...unexpected keyword argument 'thetb'...
+    >>> wide(1, a=2)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    TypeError: ...multiple values for ...argument 'a'...
+
+    >>> class StrSubclass(str):
+    ...     pass
+    >>> wide(**{StrSubclass('gamma'): 7})
+    (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0)
+    """
+    return a, b, c, d, e, f, g, h, alpha, beta, gamma, delta, epsilon, zeta, eta, theta
+
+
+def wide_posonly(p, /, a=0, b=0, c=0, d=0, e=0, f=0, g=0, h=0, *, kw1=0, kw2=0):
+    """
+    >>> wide_posonly(1, kw2=2, h=3)
+    (1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2)
+    >>> wide_posonly(1, p=2)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    TypeError: ...unexpected keyword argument 'p'...
+    """
+    return p, a, b, c, d, e, f, g, h, kw1, kw2
+
+
+cdef class Wide:
+    """
+    >>> Wide(kw2=1, a=2).values
+    (2, 0, 0, 0, 0, 0, 0, 0, 0, 1)
+    >>> Wide(**{''.join(['k', 'w1']): 3}).values
+    (0, 0, 0, 0, 0, 0, 0, 0, 3, 0)
+    >>> Wide(kw3=1)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    TypeError: ...unexpected keyword argument 'kw3'...
+    >>> Wide(1, a=2)  # doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    TypeError: ...multiple values for ...argument 'a'...
+    """
+    cdef readonly tuple values
+
+    def __init__(self, a=0, b=0, c=0, d=0, e=0, f=0, g=0, h=0, kw1=0, kw2=0):
+        self.values = (a, b, c, d, e, f, g, h, kw1, kw2)
@@ -0,0 +1,95 @@
+# mode: run
+# tag: threads
+# cython: parallel_backend=threads
+
+# This runs the tests of "sequential_parallel.pyx" in Cython's own thread
+# pool instead of OpenMP, plus some tests that need more than one thread.
+
+include "sequential_parallel.pyx"
+
+
+def test_threads_backend_threadids(int num_threads):
+    """
+    >>> test_threads_backend_threadids(4)
+    [0, 1, 2, 3]
+    >>> test_threads_backend_threadids(1)
+    [0]
+    """
+    cdef int tid
+    seen = []
+    with nogil, cython.parallel.parallel(num_threads=num_threads):
+        tid = threadid()
+        with gil:
+            seen.append(tid)
+    return sorted(seen)
+
+
+def test_threads_backend_schedules(int n):
+    """
+    >>> test_threads_backend_schedules(1000)
+    (499500, 499500, 499500, 499500, 999, 999, 999, 999)
+    """
+    cdef Py_ssize_t i, j, k, m
+    cdef long s1 = 0, s2 = 0, s3 = 0, s4 = 0
+
+    for i in prange(n, nogil=True, num_threads=4):
+        s1 += i
+    for j in prange(n, nogil=True, num_threads=4, schedule='static'):
+        s2 += j
+    for k in prange(n, nogil=True, num_threads=4, schedule='dynamic', chunksize=7):
+        s3 += k
+    for m in prange(n, nogil=True, num_threads=4, schedule='guided'):
+        s4 += m
+    return s1, s2, s3, s4, i, j, k, m
+
+
+def test_threads_backend_lastprivate(int n):
+    """
+    >>> test_threads_backend_lastprivate(1000)
+    (1998, 999)
+    """
+    cdef int i, x = 0
+    for i in prange(n, nogil=True, num_threads=4):
+        x = i * 2
+    return x, i
+
+
+def test_threads_backend_reductions(double[:] values):
+    """
+    >>> from array import array
+    >>> test_threads_backend_reductions(array('d', range(1, 11)))
+    (55.0, -55.0, 3628800.0)
+    """
+    cdef Py_ssize_t i
+    cdef double total = 0, negated = 0, product = 1
+    for i in prange(values.shape[0], nogil=True, num_threads=3, schedule='dynamic'):
+        total += values[i]
+        negated -= values[i]
+        product *= values[i]
+    return total, negated, product
+
+
+def test_threads_backend_exception(int n):
+    """
+    >>> test_threads_backend_exception(1000)
+    Traceback (most recent call last):
+    ValueError: 500
+    """
+    cdef int i
+    for i in prange(n, nogil=True, num_threads=4):
+        if i == 500:
+            with gil:
+                raise ValueError(i)
+
+
+def test_threads_backend_nested(int n):
+    """
+    >>> test_threads_backend_nested(10)
+    2025
+    """
+    cdef int i, j
+    cdef long s = 0
+    for i in prange(n, nogil=True, num_threads=4):
+        for j in prange(n):
+            s += i * j
+    return s
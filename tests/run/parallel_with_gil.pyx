@@ -158,5 +158,96 @@ def test_parallel_prange_with_python():
     for i in range(100):
         assert out[i] == i
 
+def test_prange_python_privates(int n):
+    """
+    >>> test_prange_python_privates(100)
+    (True, 99, 99)
+    """
+    cdef int i
+    out = [None] * n
+    x = None
+    s = ""
+    for i in prange(n, schedule='dynamic'):
+        # each thread assigns to its own reference
+        x = f(i)
+        s = str(x)
+        out[i] = x
+    # the values from the last iteration
+    return out == list(range(n)), x, int(s)
+
+def test_prange_python_privates_no_iterations():
+    """
+    >>> test_prange_python_privates_no_iterations()
+    'unchanged'
+    """
+    cdef int i
+    x = 'unchanged'
+    for i in prange(0):
+        x = f(i)
+    return x
+
+def test_prange_python_privates_continue(int n):
+    """
+    >>> test_prange_python_privates_continue(10)
+    (9, 9)
+    """
+    cdef int i, ci = -1
+    x = None
+    for i in prange(n):
+        x = f(i)
+        ci = i
+        if i == n - 1:
+            continue
+    return x, ci
+
+@cython.parallel_backend("threads")
+def test_prange_python_privates_threads_backend(int n):
+    """
+    The thread pool does not run sections that hold the GIL, so this uses OpenMP.
+
+    >>> test_prange_python_privates_threads_backend(10)
+    (45, 9)
+    """
+    cdef int i, total = 0
+    x = None
+    for i in prange(n):
+        x = f(i)
+        total += i
+    return total, x
+
+cdef class Value:
+    cdef readonly int value
+    def __init__(self, value):
+        self.value = value
+
+def test_prange_extension_type_privates(int n):
+    """
+    >>> test_prange_extension_type_privates(100)
+    (4950, 99)
+    """
+    cdef int i
+    cdef Value v = None
+    values = [0] * n
+    for i in prange(n):
+        v = Value(i)
+        values[i] = v.value
+    return sum(values), v.value
+
+def test_parallel_python_privates():
+    """
+    >>> test_parallel_python_privates()
+    """
+    cdef int maxthreads = openmp.omp_get_max_threads()
+    lst = [None]*maxthreads
+    x = None
+
+    with parallel():
+        x = threadid()
+        lst[x] = x
+
+    for i in range(maxthreads):
+        assert lst[i] == i
+
 _WARNINGS = """
+213:19: parallel_backend='threads' does not support parallel sections that hold the GIL, using OpenMP
 """
@@ -957,3 +957,66 @@ def test_type_inference_two_step(unsigned char[:] x):
     for n in prange(length, nogil=True):  # then used to infer the type of n
         x[n] = n
     assert cython.typeof(n) == "Py_ssize_t", cython.typeof(n)
+
+cdef struct _histogram_stats:
+    long count
+    double total
+
+def test_element_reduction_memoryview(int[:] data, long[:] out, strategy):
+    """
+    >>> from array import array
+    >>> out = array('l', [0] * 5)
+    >>> test_element_reduction_memoryview(array('i', [i % 5 for i in range(1000)]), out, 'tree')
+    >>> list(out)
+    [200, 200, 200, 200, 200]
+    >>> test_element_reduction_memoryview(array('i', [i % 3 for i in range(1000)]), out, 'atomic')
+    >>> list(out)
+    [534, 533, 533, 200, 200]
+    """
+    cdef Py_ssize_t i
+    if strategy == 'tree':
+        for i in prange(data.shape[0], nogil=True, num_threads=4, element_reduction='tree'):
+            out[data[i]] += 1
+    else:
+        for i in prange(data.shape[0], nogil=True, num_threads=4, element_reduction='atomic'):
+            out[data[i]] += 1
+
+def test_element_reduction_2d(int[:] data, double[:, :] out):
+    """
+    >>> from array import array
+    >>> out = memoryview(array('d', [1] * 6)).cast('B').cast('d', [3, 2])
+    >>> test_element_reduction_2d(array('i', range(60)), out)
+    >>> out.tolist()
+    [[1024.0, 1024.0], [1024.0, 1024.0], [1024.0, 1024.0]]
+    """
+    cdef Py_ssize_t i
+    for i in prange(data.shape[0], nogil=True, num_threads=4, element_reduction='tree'):
+        out[data[i] % 3, data[i] // 3 % 2] *= 2
+
+def test_element_reduction_array(int[:] data):
+    """
+    >>> from array import array
+    >>> test_element_reduction_array(array('i', range(100)))
+    [1, 1, 1, 1, 0, 0, 1, 1]
+    """
+    cdef Py_ssize_t i
+    cdef int bits[8]
+    bits[:] = [0, 0, 0, 0, 0, 0, 1, 1]
+    for i in prange(data.shape[0], nogil=True, num_threads=4, element_reduction='atomic'):
+        bits[data[i] % 8] ^= 1
+    return bits
+
+def test_element_reduction_struct(double[:] data):
+    """
+    >>> from array import array
+    >>> test_element_reduction_struct(array('d', range(100)))
+    (100, 4960.0)
+    """
+    cdef Py_ssize_t i
+    cdef _histogram_stats stats
+    stats.count = 0
+    stats.total = 10
+    for i in prange(data.shape[0], nogil=True, num_threads=4, element_reduction='tree'):
+        stats.count += 1
+        stats.total += data[i]
+    return stats.count, stats.total